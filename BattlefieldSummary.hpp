@@ -0,0 +1,38 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * BattlefieldSummary.hpp - Per-tick overview of the critters in play
+ *
+ * Purpose: Holds the wave-wide facts that every tower's strategy selection
+ * needs (how many critters are alive, how far the leader has got, which
+ * types are present, whether any are about to leak). The spawner fills it
+ * once per tick so towers don't each rescan every critter.
+ *
+ * Dependencies: CritterTypeRegistry, array
+ */
+/**
+ * @file BattlefieldSummary.hpp
+ * @brief Implementation of Battlefield Summary header file
+ */
+
+#ifndef BATTLEFIELDSUMMARY_HPP
+#define BATTLEFIELDSUMMARY_HPP
+
+#include <array>
+#include <limits>
+#include "CritterTypeRegistry.hpp"
+
+struct BattlefieldSummary {
+    // Path progress past which a critter counts as near the exit (last 30% of the path)
+    static constexpr float NEAR_EXIT_PROGRESS = 0.7f;
+
+    int aliveCount = 0;
+    float maxProgress = 0.0f;        // Furthest path progress of any live critter, 0 to 1
+    bool hasNearExit = false;        // Some live critter is past NEAR_EXIT_PROGRESS
+    int level3Count = 0;             // Live critters whose type is level 3
+    // Live critters per CritterTypeId
+    std::array<int, std::numeric_limits<CritterTypeId>::max() + 1> typeCounts{};
+};
+
+#endif // BATTLEFIELDSUMMARY_HPP
@@ -0,0 +1,144 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * BenchSupport.hpp - Helpers shared by the benchmark tools
+ *
+ * Purpose: Command line parsing for map and number options, tower spot
+ * selection next to the path, and peak memory reporting. Used by td_bench
+ * and td_microbench; the game itself does not include it.
+ *
+ * Dependencies: MapGenerator, TileGrid, string, vector
+ */
+/**
+ * @file BenchSupport.hpp
+ * @brief Implementation of Bench Support header file
+ */
+
+#ifndef BENCHSUPPORT_HPP
+#define BENCHSUPPORT_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "MapGenerator.h"
+#include "TileGrid.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace bench {
+
+constexpr float TILE_SIZE = 64.0f;
+
+// Level and size to build, from a --map value
+struct MapChoice {
+    int level = 1;
+    int width = 0;
+    int height = 0;
+    std::string name = "easy";
+};
+
+inline int parseInt(const std::string& option, const std::string& value, int minValue) {
+    try {
+        std::size_t used = 0;
+        int parsed = std::stoi(value, &used);
+        if (used == value.size() && parsed >= minValue) {
+            return parsed;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::runtime_error("Invalid value for " + option + ": " + value);
+}
+
+// Comma separated list of integers, e.g. "10,100,1000"
+inline std::vector<int> parseIntList(const std::string& option, const std::string& value, int minValue) {
+    std::vector<int> values;
+    std::size_t start = 0;
+    while (start <= value.size()) {
+        std::size_t comma = value.find(',', start);
+        if (comma == std::string::npos) comma = value.size();
+        values.push_back(parseInt(option, value.substr(start, comma - start), minValue));
+        start = comma + 1;
+    }
+    return values;
+}
+
+// easy, normal, hard, or WxH for a synthetic serpentine map
+inline MapChoice parseMap(const std::string& value) {
+    MapChoice choice;
+    choice.name = value;
+    if (value == "easy") {
+        choice.level = 1;
+    } else if (value == "normal") {
+        choice.level = 2;
+    } else if (value == "hard") {
+        choice.level = 3;
+    } else {
+        std::size_t x = value.find('x');
+        if (x == std::string::npos) {
+            throw std::runtime_error("Unknown map: " + value);
+        }
+        choice.level = MapGenerator::SYNTHETIC_LEVEL;
+        choice.width = parseInt("--map", value.substr(0, x), 8);
+        choice.height = parseInt("--map", value.substr(x + 1), 8);
+    }
+    return choice;
+}
+
+// Scenery tiles, in row-major order; only those touching the path if nextToPath
+inline std::vector<sf::Vector2i> towerSpots(const TileGrid& tiles, bool nextToPath) {
+    std::vector<sf::Vector2i> spots;
+    for (int y = 0; y < tiles.getHeight(); ++y) {
+        for (int x = 0; x < tiles.getWidth(); ++x) {
+            if (tiles.get(x, y) != Tile::TileType::Scenery) continue;
+
+            bool touchesPath = false;
+            for (int dy = -1; dy <= 1 && !touchesPath; ++dy) {
+                for (int dx = -1; dx <= 1 && !touchesPath; ++dx) {
+                    touchesPath = tiles.isPath(x + dx, y + dy);
+                }
+            }
+            if (!nextToPath || touchesPath) {
+                spots.emplace_back(x, y);
+            }
+        }
+    }
+    return spots;
+}
+
+// Center of a tile, in pixels
+inline sf::Vector2f tileCenter(const sf::Vector2i& tile) {
+    return sf::Vector2f((tile.x + 0.5f) * TILE_SIZE, (tile.y + 0.5f) * TILE_SIZE);
+}
+
+// Peak resident set size of this process, in bytes
+inline std::size_t peakMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<std::size_t>(usage.ru_maxrss);          // bytes
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;   // kilobytes
+#endif
+#endif
+}
+
+} // namespace bench
+
+#endif // BENCHSUPPORT_HPP
@@ -0,0 +1,146 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * CounterRegistry.cpp - Hot path event counters implementation
+ *
+ * Purpose: Keeps the list of per-thread counter blocks. It folds a block
+ * into the retired totals when its thread exits, and sums the blocks on
+ * read. Only registration, exit and reads take the registry lock.
+ *
+ * Dependencies: CounterRegistry.hpp, algorithm, fstream, mutex, ostream, stdexcept, string, vector
+ */
+
+/**
+ * @file CounterRegistry.cpp
+ * @brief Implements the per-thread counter registry
+ */
+
+#include "CounterRegistry.hpp"
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Values = std::array<std::atomic<std::uint64_t>, CounterRegistry::COUNTER_COUNT>;
+
+struct Blocks {
+    std::mutex mutex;
+    std::vector<const Values*> live;
+    CounterRegistry::Snapshot retired{};   // Totals of threads that have exited
+    CounterRegistry::Snapshot baseline{};  // Totals at the last reset()
+};
+
+Blocks& blocks() {
+    static Blocks registered;
+    return registered;
+}
+
+// One per thread; joins the registry on construction and leaves it on exit
+struct ThreadBlock {
+    alignas(64) Values values{};
+
+    ThreadBlock() {
+        Blocks& all = blocks();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        all.live.push_back(&values);
+    }
+
+    ~ThreadBlock() {
+        Blocks& all = blocks();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            all.retired[i] += values[i].load(std::memory_order_relaxed);
+        }
+        all.live.erase(std::remove(all.live.begin(), all.live.end(), &values), all.live.end());
+    }
+};
+
+// Sum of every live and retired block; caller holds the lock
+CounterRegistry::Snapshot totals(const Blocks& all) {
+    CounterRegistry::Snapshot sum = all.retired;
+    for (const Values* values : all.live) {
+        for (std::size_t i = 0; i < sum.size(); ++i) {
+            sum[i] += (*values)[i].load(std::memory_order_relaxed);
+        }
+    }
+    return sum;
+}
+
+} // namespace
+
+Values& CounterRegistry::localValues() {
+    thread_local ThreadBlock block;
+    return block.values;
+}
+
+CounterRegistry& CounterRegistry::instance() {
+    static CounterRegistry registry;
+    return registry;
+}
+
+CounterRegistry::Snapshot CounterRegistry::snapshot() const {
+    Blocks& all = blocks();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    Snapshot sum = totals(all);
+    for (std::size_t i = 0; i < sum.size(); ++i) {
+        sum[i] -= all.baseline[i];
+    }
+    return sum;
+}
+
+std::uint64_t CounterRegistry::get(Counter counter) const {
+    return snapshot()[static_cast<std::size_t>(counter)];
+}
+
+void CounterRegistry::reset() {
+    Blocks& all = blocks();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    all.baseline = totals(all);
+}
+
+const char* CounterRegistry::getName(Counter counter) {
+    switch (counter) {
+        case Counter::SIM_STEPS: return "sim_steps";
+        case Counter::FIND_TARGET_CALLS: return "find_target_calls";
+        case Counter::CRITTERS_SCANNED: return "critters_scanned";
+        case Counter::DISTANCE_CHECKS: return "distance_checks";
+        case Counter::STRATEGY_SMART: return "strategy_smart";
+        case Counter::STRATEGY_EXIT_PROXIMITY: return "strategy_exit_proximity";
+        case Counter::STRATEGY_STRONGEST: return "strategy_strongest";
+        case Counter::STRATEGY_WEAKEST: return "strategy_weakest";
+        case Counter::STRATEGY_CLOSEST: return "strategy_closest";
+        case Counter::PROJECTILES_SPAWNED: return "projectiles_spawned";
+        case Counter::PROJECTILES_EXPIRED: return "projectiles_expired";
+        case Counter::PROJECTILES_REFUSED: return "projectiles_refused";
+        case Counter::SPLASH_HITS: return "splash_hits";
+        case Counter::NOTIFY_MAP: return "notify_map";
+        case Counter::NOTIFY_CRITTERS: return "notify_critters";
+        case Counter::NOTIFY_TOWERS: return "notify_towers";
+        case Counter::NOTIFY_OTHER: return "notify_other";
+        default: return "unknown";
+    }
+}
+
+void CounterRegistry::writeJson(std::ostream& out) const {
+    Snapshot values = snapshot();
+    out << "{\n";
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        out << "  \"" << getName(static_cast<Counter>(i)) << "\": " << values[i]
+            << (i + 1 < values.size() ? ",\n" : "\n");
+    }
+    out << "}\n";
+}
+
+void CounterRegistry::dump(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not write counters file: " + path);
+    }
+    writeJson(file);
+}
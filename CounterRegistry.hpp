@@ -0,0 +1,86 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * CounterRegistry.hpp - Hot path event counters
+ *
+ * Purpose: Counts how often the hot paths do their work: target scans,
+ * critters scanned, range checks, strategy choices, projectiles and splash
+ * hits, and observer notifications. Each thread bumps its own block of
+ * relaxed atomics, so counting takes no lock and shares no cache line.
+ * Reads sum every thread's block. reset() records a baseline rather than
+ * writing to other threads' counters.
+ *
+ * Dependencies: array, atomic, cstdint, iosfwd, string
+ */
+/**
+ * @file CounterRegistry.hpp
+ * @brief Implementation of Counter Registry header file
+ */
+
+#ifndef COUNTERREGISTRY_HPP
+#define COUNTERREGISTRY_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+enum class Counter : std::uint8_t {
+    SIM_STEPS,              // Fixed simulation steps, for per-tick rates
+    FIND_TARGET_CALLS,
+    CRITTERS_SCANNED,       // Live critters in range scored by a target scan
+    DISTANCE_CHECKS,        // Points tested against a radius by the range kernel
+    STRATEGY_SMART,         // Strategy choices, one counter per StrategyType
+    STRATEGY_EXIT_PROXIMITY,
+    STRATEGY_STRONGEST,
+    STRATEGY_WEAKEST,
+    STRATEGY_CLOSEST,
+    PROJECTILES_SPAWNED,
+    PROJECTILES_EXPIRED,
+    PROJECTILES_REFUSED,    // Shots refused because the projectile pool was full
+    SPLASH_HITS,
+    NOTIFY_MAP,             // notify() calls, one counter per Observable
+    NOTIFY_CRITTERS,
+    NOTIFY_TOWERS,
+    NOTIFY_OTHER,
+    COUNT
+};
+
+class CounterRegistry {
+public:
+    static constexpr std::size_t COUNTER_COUNT = static_cast<std::size_t>(Counter::COUNT);
+    using Snapshot = std::array<std::uint64_t, COUNTER_COUNT>;
+
+    // Adds to the calling thread's counter; never blocks
+    static void add(Counter counter, std::uint64_t amount = 1) {
+        std::atomic<std::uint64_t>& value = localValues()[static_cast<std::size_t>(counter)];
+        // Only this thread writes the value, so no read-modify-write is needed
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // Process-wide registry of every thread's counters
+    static CounterRegistry& instance();
+
+    // Totals over all threads since the last reset()
+    Snapshot snapshot() const;
+    std::uint64_t get(Counter counter) const;
+    void reset();
+
+    static const char* getName(Counter counter);
+
+    // Writes the totals as one JSON object keyed by counter name
+    void writeJson(std::ostream& out) const;
+    // Writes writeJson() output to a file; throws if it cannot be opened
+    void dump(const std::string& path) const;
+
+private:
+    CounterRegistry() = default;
+
+    // This thread's counters, registered on first use
+    static std::array<std::atomic<std::uint64_t>, COUNTER_COUNT>& localValues();
+};
+
+#endif // COUNTERREGISTRY_HPP
@@ -19,7 +19,6 @@
  
  #include <queue>
  #include <memory>
- #include <string>
  #include "CritterSpawner.hpp"
  
  // Abstract Creator (Factory) class
@@ -33,12 +32,12 @@
  protected:
      // Utility method to create a single critter type
      CritterSpawner::CritterType createCritterType(
-         const std::string& texturePath, 
+         CritterTypeId typeId, 
          float speed, 
          float health, 
          int reward) const 
      {
-         return {texturePath, speed, health, reward};
+         return {typeId, speed, health, reward};
      }
  };
  
@@ -50,7 +49,7 @@
          
          // Critter type for easy waves
          CritterSpawner::CritterType critter1 = createCritterType(
-             "textures/critter.png", 
+             CritterTypeRegistry::BASIC, 
              100.f + (waveNumber * 5.f), // Small speed increase per wave
              100.f + (waveNumber * 10.f), // Small health increase per wave
              5 + waveNumber // Small reward increase per wave
@@ -73,14 +72,14 @@
          
          // Two critter types for medium waves
          CritterSpawner::CritterType critter1 = createCritterType(
-             "textures/critter.png", 
+             CritterTypeRegistry::BASIC, 
              100.f + (waveNumber * 5.f),
              120.f + (waveNumber * 15.f),
              7 + waveNumber
          );
          
          CritterSpawner::CritterType critter2 = createCritterType(
-             "textures/critter2.png", 
+             CritterTypeRegistry::MEDIUM, 
              100.f + (waveNumber * 2.f),
              200.f + (waveNumber * 25.f),
              10 + (waveNumber * 2)
@@ -111,7 +110,7 @@
          int reward = 10 + (adjustedWave * 5);
          
          CritterSpawner::CritterType critter2 = createCritterType(
-             "textures/critter2.png",
+             CritterTypeRegistry::MEDIUM,
              speed,
              health,
              reward
@@ -123,7 +122,7 @@
          int strongReward = 50 + (adjustedWave * 25);
          
          CritterSpawner::CritterType critter3 = createCritterType(
-             "textures/critter3.png",
+             CritterTypeRegistry::STRONG,
              strongSpeed,
              strongHealth,
              strongReward
@@ -27,6 +27,7 @@ class CritterObserver : public IObserver {
 private:
     CritterSpawner* subject;
     sf::RenderWindow* window;
+    bool changed = true;  // Nothing has been rendered yet
 
 public:
     CritterObserver(CritterSpawner* c, sf::RenderWindow* win)
@@ -39,9 +40,21 @@ public:
         subject->removeObserver(this);
     }
 
+    // Only records that the critters changed; drawing belongs to render()
     void update() override {
-        subject->draw(*window);
+        changed = true;
     }
+
+    // Render phase: draws the subject and clears the change record
+    void render() {
+        if (window && subject) {
+            subject->draw(*window);
+        }
+        changed = false;
+    }
+
+    // True if the subject reported a change since the last render()
+    bool hasChanged() const { return changed; }
 };
 
 #endif // CRITTEROBSERVER_HPP
\ No newline at end of file
@@ -7,7 +7,7 @@
  * Purpose: Implements wave spawning mechanics, enemy type generation,
  * and manages active enemies during gameplay.
  * 
- * Dependencies: SFML 3.0, CritterSpawner.hpp, Critter.hpp, CritterFactory.hpp
+ * Dependencies: SFML 3.0, CritterSpawner.hpp, CritterStore.hpp, CritterFactory.hpp, FrameProfiler
  */
 
  /**
@@ -16,11 +16,16 @@
  */
 
  #include "CritterSpawner.hpp"
- #include "Critter.hpp"
+ #include <algorithm>
+ #include <stdexcept>
  #include "CritterFactory.hpp"
+ #include "FrameProfiler.hpp"
  
- CritterSpawner::CritterSpawner(const std::vector<sf::Vector2f>& waypoints)
-     : pathWaypoints(waypoints), 
+ CritterSpawner::CritterSpawner(const std::vector<sf::Vector2f>& waypoints,
+                                const std::vector<float>& pathLengths)
+     : Observable(Counter::NOTIFY_CRITTERS),
+       pathWaypoints(waypoints), 
+       pathLengths(pathLengths),
        spawnTimer(0.0f),
        currentWave(1),
        waveInProgress(false),
@@ -39,6 +44,8 @@
  
  void CritterSpawner::setupWave() {
      populateWaveQueue(currentWave);
+     critters.reserve(critters.size() + spawnQueue.size());
+     critters.reservePathArea(pathWaypoints);
      waveInProgress = true;
  }
  
@@ -48,34 +55,22 @@
  }
  
  void CritterSpawner::update(float deltaTime) {
-    // Update existing critters
-    for (auto it = activecritters.begin(); it != activecritters.end();) {
-        (*it)->update(deltaTime);
-        
-        if ((*it)->isDead()) {
+    // Move every critter, then settle the ones that died or leaked
+    critters.update(deltaTime, pathWaypoints, pathLengths);
+
+    const CritterTypeRegistry& types = CritterTypeRegistry::instance();
+    for (std::size_t i = 0; i < critters.size();) {
+        if (critters.isDead(i)) {
             // Give player reward for killing critter
-            playerCurrency += (*it)->getReward();
-            it = activecritters.erase(it);
+            playerCurrency += critters.getReward(i);
+            critters.remove(i);
             notify();
         }
-        else if ((*it)->hasReachedEnd()) {
-            // Apply penalties based on critter type
-            std::string texturePath = (*it)->getTexturePath();
-            
-            // Apply currency penalty (existing logic)
-            if (texturePath == "textures/critter.png") {
-                playerCurrency -= 10;
-                // New: Deduct 1 life point for level 1 critter
-                lifePoints -= 1;
-            } else if (texturePath == "textures/critter2.png") {
-                playerCurrency -= 50;
-                // New: Deduct 2 life points for level 2 critter
-                lifePoints -= 2;
-            } else if (texturePath == "textures/critter3.png") {
-                playerCurrency -= 100;
-                // New: Deduct 3 life points for level 3 critter
-                lifePoints -= 3;
-            }
+        else if (critters.hasReachedEnd(i)) {
+            // Apply the currency and life penalties for this critter type
+            const CritterTypeInfo& type = types.get(critters.getTypeId(i));
+            playerCurrency -= type.leakGoldPenalty;
+            lifePoints -= type.leakLifeCost;
             
             // Check if player has lost the game
             if (lifePoints <= 0) {
@@ -86,10 +81,11 @@
                 waveInProgress = false;
             }
             
-            it = activecritters.erase(it);
+            // Swap-and-pop moves the last critter into slot i, so don't advance
+            critters.remove(i);
             notify();
         } else {
-            ++it;
+            ++i;
         }
     }
 
@@ -99,22 +95,28 @@
         if (!spawnQueue.empty()) {
             spawnTimer += deltaTime;
             if (spawnTimer >= SPAWN_DELAY) {
+                if (pathWaypoints.empty()) {
+                    throw std::runtime_error("ERROR: Critter path is empty! Check MapGenerator.");
+                }
                 const CritterType& type = spawnQueue.front();
-                activecritters.push_back(std::make_unique<Critter>(
-                    pathWaypoints,
-                    type.texturePath,
-                    type.speed,
-                    type.health,
-                    type.reward
-                ));
+                critters.spawn(pathWaypoints.front(),
+                               type.typeId,
+                               type.speed,
+                               type.health,
+                               type.reward);
                 spawnQueue.pop();
                 spawnTimer = 0.0f;
                 notify();
             }
         }
         
+        // Index the final positions and summarize the wave once so this
+        // tick's range queries and strategy selections are cheap
+        critters.rebuildSpatialIndex();
+        rebuildSummary();
+
         // Check if wave is complete
-        if (waveInProgress && spawnQueue.empty() && activecritters.empty()) {
+        if (waveInProgress && spawnQueue.empty() && critters.empty()) {
             waveInProgress = false;
             
             if (currentWave < 3) {
@@ -126,11 +128,109 @@
     }
 }
  
+CritterHandle CritterSpawner::spawnOnPath(const CritterType& type, float distanceAlongPath) {
+    if (pathWaypoints.empty()) {
+        throw std::runtime_error("ERROR: Critter path is empty! Check MapGenerator.");
+    }
+    float distance = std::clamp(distanceAlongPath, 0.0f, pathLengths.back());
+
+    // Head for the first waypoint at or past that distance, starting on the
+    // segment leading to it
+    std::size_t next = std::lower_bound(pathLengths.begin(), pathLengths.end(), distance) - pathLengths.begin();
+    sf::Vector2f position = pathWaypoints[next];
+    if (next > 0) {
+        float segment = pathLengths[next] - pathLengths[next - 1];
+        float t = segment > 0.0f ? (distance - pathLengths[next - 1]) / segment : 1.0f;
+        position = pathWaypoints[next - 1] + (pathWaypoints[next] - pathWaypoints[next - 1]) * t;
+    }
+
+    CritterHandle handle = critters.spawn(position, type.typeId, type.speed, type.health, type.reward,
+                                          static_cast<int>(next), distance);
+    notify();
+    return handle;
+}
+
+void CritterSpawner::rebuildSummary() {
+    const CritterTypeRegistry& types = CritterTypeRegistry::instance();
+    summary = BattlefieldSummary();
+
+    for (std::size_t i = 0; i < critters.size(); ++i) {
+        if (critters.isDead(i)) continue;
+
+        summary.aliveCount++;
+        CritterTypeId type = critters.getTypeId(i);
+        summary.typeCounts[type]++;
+        if (types.get(type).level == 3) {
+            summary.level3Count++;
+        }
+        summary.maxProgress = std::max(summary.maxProgress, critters.getProgress(i));
+    }
+    summary.hasNearExit = summary.maxProgress > BattlefieldSummary::NEAR_EXIT_PROGRESS;
+}
+
 void CritterSpawner::draw(sf::RenderWindow& window) {
-    for (const auto& critter : activecritters) {
-        window.draw(critter->getSprite());
-        critter->drawHealthBar(window);  // Draw health bar after the sprite
+    CritterTypeRegistry& types = CritterTypeRegistry::instance();
+    std::uint32_t drawCalls = 0;
+
+    for (std::size_t i = 0; i < critters.size(); ++i) {
+        sf::Sprite sprite(types.getTexture(critters.getTypeId(i)));
+        sprite.setScale(sf::Vector2f(CritterStore::SPRITE_SCALE, CritterStore::SPRITE_SCALE));
+
+        // Visual feedback with different colors based on damage type
+        if (critters.getFlashTimer(i) > 0) {
+            sprite.setColor(critters.hasFlag(i, CritterStore::SPECIAL_FLASH)
+                                ? sf::Color(255, 0, 255, 255)   // Bright magenta for special tower hits
+                                : sf::Color(255, 0, 0, 255));   // Bright red for normal hits
+        }
+
+        sprite.setPosition(critters.getInterpolatedPosition(i, interpolationAlpha));
+        window.draw(sprite);
+        drawHealthBar(window, i);  // Draw health bar after the sprite
+        drawCalls += critters.isDead(i) ? 1 : 3;  // Sprite, plus two bars while alive
     }
+    FrameProfiler::instance().countDrawCalls(drawCalls);
+}
+
+void CritterSpawner::drawHealthBar(sf::RenderWindow& window, std::size_t index) const {
+    // Don't draw health bars for dead critters
+    if (critters.isDead(index)) return;
+    
+    // Sprite bounds at the interpolated draw position
+    sf::FloatRect bounds(critters.getInterpolatedPosition(index, interpolationAlpha),
+                         sf::Vector2f(CritterStore::SPRITE_SIZE, CritterStore::SPRITE_SIZE));
+    
+    // Calculate health bar dimensions
+    const float BAR_WIDTH = bounds.size.x;  // SFML 3.0 uses size.x
+    const float BAR_HEIGHT = 5.0f;
+    const float BAR_OFFSET = 5.0f;  // Distance above sprite
+    
+    // bound size and position
+    float centerX = bounds.position.x + bounds.size.x / 2.0f;
+    
+    // Background (empty) health bar - red
+    sf::RectangleShape backgroundBar(sf::Vector2f(BAR_WIDTH, BAR_HEIGHT));
+    backgroundBar.setFillColor(sf::Color(200, 0, 0, 200));  // Semi-transparent red
+    
+    // Position using the calculated center X position
+    backgroundBar.setPosition(
+        sf::Vector2f(
+            centerX - BAR_WIDTH/2,  // Center horizontally using the sprite's center
+            bounds.position.y - bounds.size.y/2 - BAR_HEIGHT - BAR_OFFSET  // Position above sprite
+        )
+    );
+    
+    // Calculate filled portion of health bar
+    float healthRatio = critters.getHealth(index) / critters.getMaxHealth(index);
+    float fillWidth = BAR_WIDTH * healthRatio;
+    
+    // Filled health bar - green
+    sf::RectangleShape fillBar(sf::Vector2f(fillWidth, BAR_HEIGHT));
+    fillBar.setFillColor(sf::Color(0, 200, 0, 200));  // Semi-transparent green
+    fillBar.setPosition(backgroundBar.getPosition());
+    
+    // Draw both bars
+    window.draw(backgroundBar);
+    window.draw(fillBar);
 }
  
  bool CritterSpawner::isWaveComplete() const {
@@ -139,19 +239,20 @@ void CritterSpawner::draw(sf::RenderWindow& window) {
 
 
 // Critter Inspect Feature
- Critter* CritterSpawner::getCritterUnderMouse(const sf::Vector2f& mousePos) const {
-    for (const auto& critter : activecritters) {
-        if (critter->isDead()) continue;
-        
-        // Get the critter's sprite bounds
-        sf::FloatRect bounds = critter->getSprite().getGlobalBounds();
+ CritterHandle CritterSpawner::getCritterUnderMouse(const sf::Vector2f& mousePos) const {
+    // A critter's position is the top-left of its sprite, so any critter under
+    // the mouse is within one sprite diagonal of it
+    const float searchRadius = CritterStore::SPRITE_SIZE * 1.415f;
+    int hovered = -1;
+
+    critters.queryRadius(mousePos, searchRadius, [&](std::size_t i) {
+        if (hovered >= 0 || critters.isDead(i)) return;
         
         // Check if the mouse position is inside the sprite bounds
-        if (bounds.contains(mousePos)) {
-            return critter.get();
+        if (critters.getBounds(i).contains(mousePos)) {
+            hovered = static_cast<int>(i);
         }
-    }
+    });
     
-    // No critter found under the mouse
-    return nullptr;
-}
\ No newline at end of file
+    return hovered >= 0 ? critters.handleAt(hovered) : CritterHandle();
+}
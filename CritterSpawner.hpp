@@ -7,7 +7,7 @@
  * Purpose: Controls enemy wave spawning, difficulty progression,
  * and manages active enemies on the map.
  * 
- * Dependencies: SFML 3.0, Critter
+ * Dependencies: SFML 3.0, CritterStore, CritterTypeRegistry, BattlefieldSummary
  */
 /**
  * @file CritterSpawner.hpp
@@ -20,23 +20,26 @@
 #include <queue>
 #include <memory>
 #include "Observer.hpp"
-
-class Critter;
+#include "CritterStore.hpp"
+#include "CritterTypeRegistry.hpp"
+#include "BattlefieldSummary.hpp"
 
 class CritterSpawner : public Observable {
     public:
        struct CritterType {
-           std::string texturePath;
+           CritterTypeId typeId;
            float speed;
            float health;
            int reward;
        };
     
-       CritterSpawner(const std::vector<sf::Vector2f>& waypoints);
+       CritterSpawner(const std::vector<sf::Vector2f>& waypoints, const std::vector<float>& pathLengths);
        
        void startNextWave();
        void update(float deltaTime);
        void draw(sf::RenderWindow& window);
+       // Fraction of a simulation step elapsed since the last update, used by draw()
+       void setInterpolationAlpha(float alpha) { interpolationAlpha = alpha; }
        bool isWaveComplete() const;
        int getCurrentWave() const { return currentWave; }
        int getPlayerCurrency() const { return playerCurrency; }
@@ -56,7 +59,8 @@ class CritterSpawner : public Observable {
         playerCurrency = 1000;
         lifePoints = 10;
         gameOver = false;
-        activecritters.clear();
+        critters.clear();
+        summary = BattlefieldSummary();
         spawnQueue = std::queue<CritterType>();
     }
        
@@ -67,21 +71,33 @@ class CritterSpawner : public Observable {
           return !waveInProgress; 
        }
        
-       std::vector<std::unique_ptr<Critter>>& getActiveCritters() {
-           return activecritters;
-       }
+       CritterStore& getCritters() { return critters; }
+       const CritterStore& getCritters() const { return critters; }
+       // Wave-wide critter statistics, refreshed once per update()
+       const BattlefieldSummary& getSummary() const { return summary; }
        
        void adjustPlayerCurrency(int amount) { playerCurrency += amount; }
+       void adjustLifePoints(int amount) { lifePoints += amount; }
+
+       // Puts a critter straight onto the path, distanceAlongPath pixels from
+       // the start, bypassing the wave queue (headless benchmark)
+       CritterHandle spawnOnPath(const CritterType& type, float distanceAlongPath);
     
-       Critter* getCritterUnderMouse(const sf::Vector2f& mousePos) const;
+       // Returns a handle to the critter under the mouse, or a null handle
+       CritterHandle getCritterUnderMouse(const sf::Vector2f& mousePos) const;
 
     
     private:
        void setupWave();
        void populateWaveQueue(int wave);
+       void drawHealthBar(sf::RenderWindow& window, std::size_t index) const;
+       void rebuildSummary();
     
        const std::vector<sf::Vector2f>& pathWaypoints;
-       std::vector<std::unique_ptr<Critter>> activecritters;
+       const std::vector<float>& pathLengths;
+       CritterStore critters;
+       BattlefieldSummary summary;
+       float interpolationAlpha = 1.0f;
        std::queue<CritterType> spawnQueue;
        float spawnTimer;
        const float SPAWN_DELAY = 1.0f; // Time between spawns
@@ -0,0 +1,231 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * CritterStore.cpp - Structure-of-arrays critter storage implementation
+ * 
+ * Purpose: Implements critter spawning, swap-and-pop removal, waypoint
+ * movement and damage over the contiguous critter arrays, and keeps the
+ * spatial index in sync.
+ * 
+ * Dependencies: CritterStore.hpp, cmath
+ */
+
+/**
+ * @file CritterStore.cpp
+ * @brief Implementation of the Critter Store
+ */
+
+#include "CritterStore.hpp"
+#include <algorithm>
+#include <cmath>
+
+CritterHandle CritterStore::spawn(const sf::Vector2f& position,
+                                         CritterTypeId type,
+                                         float moveSpeed,
+                                         float hp,
+                                         int rewardPoints,
+                                         int startWaypoint,
+                                         float startDistance)
+{
+    // Reuse a freed slot if there is one; its generation was bumped on removal
+    std::uint32_t slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        indexOfSlot[slot] = static_cast<int>(size());
+    } else {
+        slot = static_cast<std::uint32_t>(indexOfSlot.size());
+        indexOfSlot.push_back(static_cast<int>(size()));
+        slotGeneration.push_back(0);
+        // Room to free every slot, so removing a critter never allocates
+        freeSlots.reserve(slotGeneration.capacity());
+    }
+    slotOfIndex.push_back(slot);
+
+    posX.push_back(position.x);
+    posY.push_back(position.y);
+    prevX.push_back(position.x);
+    prevY.push_back(position.y);
+    waypoint.push_back(startWaypoint);
+    distance.push_back(startDistance);
+    health.push_back(hp);
+    speed.push_back(moveSpeed);
+    flashTimer.push_back(0.0f);
+    reward.push_back(rewardPoints);
+    typeId.push_back(type);
+    flags.push_back(0);
+
+    spatialIndexDirty = true;
+    return CritterHandle{slot, slotGeneration[slot]};
+}
+
+void CritterStore::remove(std::size_t index) {
+    std::size_t last = size() - 1;
+    releaseSlot(slotOfIndex[index]);
+
+    if (index != last) {
+        posX[index] = posX[last];
+        posY[index] = posY[last];
+        prevX[index] = prevX[last];
+        prevY[index] = prevY[last];
+        waypoint[index] = waypoint[last];
+        distance[index] = distance[last];
+        health[index] = health[last];
+        speed[index] = speed[last];
+        flashTimer[index] = flashTimer[last];
+        reward[index] = reward[last];
+        typeId[index] = typeId[last];
+        flags[index] = flags[last];
+        slotOfIndex[index] = slotOfIndex[last];
+        indexOfSlot[slotOfIndex[index]] = static_cast<int>(index);
+    }
+
+    posX.pop_back();
+    posY.pop_back();
+    prevX.pop_back();
+    prevY.pop_back();
+    waypoint.pop_back();
+    distance.pop_back();
+    health.pop_back();
+    speed.pop_back();
+    flashTimer.pop_back();
+    reward.pop_back();
+    typeId.pop_back();
+    flags.pop_back();
+    slotOfIndex.pop_back();
+    spatialIndexDirty = true;
+}
+
+void CritterStore::clear() {
+    posX.clear();
+    posY.clear();
+    prevX.clear();
+    prevY.clear();
+    waypoint.clear();
+    distance.clear();
+    health.clear();
+    speed.clear();
+    flashTimer.clear();
+    reward.clear();
+    typeId.clear();
+    flags.clear();
+    // Free every live slot so outstanding handles go stale
+    for (std::uint32_t slot : slotOfIndex) {
+        releaseSlot(slot);
+    }
+    slotOfIndex.clear();
+    grid.clear();
+    spatialIndexDirty = true;
+}
+
+void CritterStore::reserve(std::size_t count) {
+    posX.reserve(count);
+    posY.reserve(count);
+    prevX.reserve(count);
+    prevY.reserve(count);
+    waypoint.reserve(count);
+    distance.reserve(count);
+    health.reserve(count);
+    speed.reserve(count);
+    flashTimer.reserve(count);
+    reward.reserve(count);
+    typeId.reserve(count);
+    flags.reserve(count);
+    slotOfIndex.reserve(count);
+    indexOfSlot.reserve(count);
+    slotGeneration.reserve(count);
+    freeSlots.reserve(count);
+    grid.reserve(count);
+}
+
+void CritterStore::reservePathArea(const std::vector<sf::Vector2f>& path) {
+    if (path.empty()) return;
+
+    // Critters only ever stand on the segments between waypoints
+    sf::Vector2f min = path.front();
+    sf::Vector2f max = path.front();
+    for (const sf::Vector2f& point : path) {
+        min.x = std::min(min.x, point.x);
+        min.y = std::min(min.y, point.y);
+        max.x = std::max(max.x, point.x);
+        max.y = std::max(max.y, point.y);
+    }
+    grid.reserveArea(min, max);
+}
+
+void CritterStore::releaseSlot(std::uint32_t slot) {
+    indexOfSlot[slot] = -1;
+    ++slotGeneration[slot];
+    freeSlots.push_back(slot);
+}
+
+void CritterStore::update(float deltaTime,
+                          const std::vector<sf::Vector2f>& path,
+                          const std::vector<float>& cumulativeLengths)
+{
+    const int pathSize = static_cast<int>(path.size());
+    pathLength = cumulativeLengths.empty() ? 0.0f : cumulativeLengths.back();
+    spatialIndexDirty = true;
+
+    // Remember where everyone was so rendering can blend between ticks
+    prevX = posX;
+    prevY = posY;
+
+    for (std::size_t i = 0; i < size(); ++i) {
+        // Handle flash effect
+        if (flashTimer[i] > 0) {
+            flashTimer[i] -= deltaTime;
+        }
+
+        if ((flags[i] & (DEAD | REACHED_END)) || waypoint[i] >= pathSize) continue;
+
+        // Calculate direction to next waypoint
+        const sf::Vector2f& targetPos = path[waypoint[i]];
+        float dx = targetPos.x - posX[i];
+        float dy = targetPos.y - posY[i];
+        float remaining = std::sqrt(dx * dx + dy * dy);
+
+        if (remaining > 0.f) {
+            dx /= remaining; // Normalize direction
+            dy /= remaining;
+        }
+
+        float step = speed[i] * deltaTime;
+        posX[i] += dx * step;
+        posY[i] += dy * step;
+
+        // Check if reached waypoint
+        if (remaining < step) {
+            distance[i] = cumulativeLengths[waypoint[i]];
+            ++waypoint[i];
+            if (waypoint[i] >= pathSize) {
+                flags[i] |= REACHED_END;
+            }
+        } else {
+            // Arc length up to the target waypoint minus what is still left of this segment
+            distance[i] = cumulativeLengths[waypoint[i]] - (remaining - step);
+        }
+    }
+}
+
+void CritterStore::takeDamage(std::size_t index, float damage, bool isSpecialDamage) {
+    health[index] -= damage;
+
+    // Remember the damage type so the renderer can flash the right color
+    if (isSpecialDamage) {
+        flags[index] |= SPECIAL_FLASH;
+    } else {
+        flags[index] &= static_cast<std::uint8_t>(~SPECIAL_FLASH);
+    }
+    flashTimer[index] = FLASH_DURATION;  // Reset flash timer
+
+    if (health[index] <= 0) {
+        flags[index] |= DEAD;
+    }
+}
+
+void CritterStore::rebuildSpatialIndex() {
+    grid.rebuild(posX.data(), posY.data(), size());
+    spatialIndexDirty = false;
+}
@@ -0,0 +1,203 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * CritterStore.hpp - Structure-of-arrays critter storage
+ * 
+ * Purpose: Holds every live critter in contiguous per-field arrays (position,
+ * distance travelled along the path, health, speed, type id, flags) so that movement and targeting
+ * loops read only the fields they need. Critters are addressed by a dense index
+ * (valid for the current tick) or by a generational CritterHandle, which can be
+ * kept across ticks and safely goes stale once its critter is removed.
+ * A uniform grid over critter positions answers range queries.
+ * 
+ * Dependencies: SFML 3.0 (System), CritterTypeRegistry, MemoryTracker, SpatialHash, RangeKernel, vector, cstdint
+ */
+/**
+ * @file CritterStore.hpp
+ * @brief Implementation of Critter Store header file
+ */
+
+#ifndef CRITTERSTORE_HPP
+#define CRITTERSTORE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "CritterTypeRegistry.hpp"
+#include "MemoryTracker.hpp"
+#include "RangeKernel.hpp"
+#include "SpatialHash.hpp"
+
+/**
+ * Reference to a critter that survives swap-and-pop removal. The generation
+ * changes every time the slot is freed, so a handle to a removed critter never
+ * resolves to whichever critter reuses its slot.
+ */
+struct CritterHandle {
+    static constexpr std::uint32_t NULL_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t slot = NULL_SLOT;
+    std::uint32_t generation = 0;
+
+    bool isNull() const { return slot == NULL_SLOT; }
+    bool operator==(const CritterHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
+    bool operator!=(const CritterHandle& other) const { return !(*this == other); }
+};
+
+class CritterStore {
+public:
+
+    // Per-critter state bits
+    enum Flag : std::uint8_t {
+        DEAD          = 1 << 0,
+        REACHED_END   = 1 << 1,
+        SPECIAL_FLASH = 1 << 2   // Last hit came from a special tower
+    };
+
+    // Duration of the damage flash in seconds
+    static constexpr float FLASH_DURATION = 0.2f;
+    // Critter textures are 40x40 and drawn at half scale
+    static constexpr float SPRITE_SCALE = 0.5f;
+    static constexpr float SPRITE_SIZE = 40.0f * SPRITE_SCALE;
+    // Spatial index cell size, one map tile (MapGenerator::TILE_SIZE)
+    static constexpr float CELL_SIZE = 64.0f;
+
+    // Adds a critter at position and returns a handle to it. Critters normally
+    // start at the first waypoint; startWaypoint and startDistance place one
+    // partway along the path, heading for that waypoint with that much covered.
+    CritterHandle spawn(const sf::Vector2f& position, CritterTypeId type, float moveSpeed, float hp, int rewardPoints,
+                        int startWaypoint = 0, float startDistance = 0.0f);
+    // Removes the critter at a dense index by moving the last critter into its place
+    void remove(std::size_t index);
+    void clear();
+    // Capacity for count critters, so spawning up to that many never allocates
+    void reserve(std::size_t count);
+    // Sizes the spatial index to cover path, so it never grows while critters walk it
+    void reservePathArea(const std::vector<sf::Vector2f>& path);
+
+    // Moves every critter towards its next waypoint on path. cumulativeLengths
+    // holds the path length up to each waypoint (see MapGenerator::getWaypoints)
+    void update(float deltaTime,
+                const std::vector<sf::Vector2f>& path,
+                const std::vector<float>& cumulativeLengths);
+    // Applies damage to a critter. Special damage gets a unique visual effect
+    void takeDamage(std::size_t index, float damage, bool isSpecialDamage = false);
+
+    // Rebuilds the spatial index. Call once per tick after critters have moved
+    void rebuildSpatialIndex();
+
+    // Calls callback(index) for every critter within radius of center. Uses the
+    // spatial index when it is current, otherwise falls back to a full scan.
+    // Both paths test squared distances with the shared range kernel.
+    template <typename Callback>
+    void queryRadius(const sf::Vector2f& center, float radius, Callback&& callback) const {
+        if (spatialIndexDirty) {
+            forEachInRange(posX.data(), posY.data(), size(), center.x, center.y, radius * radius, 0,
+                           [&](std::uint32_t index) { callback(static_cast<std::size_t>(index)); });
+        } else {
+            grid.forEachInRadius(center, radius, callback);
+        }
+    }
+
+    std::size_t size() const { return posX.size(); }
+    bool empty() const { return posX.empty(); }
+
+    // Dense index of the critter a handle refers to, or -1 if it has been removed. O(1)
+    int resolve(CritterHandle handle) const {
+        if (handle.slot >= slotGeneration.size() || slotGeneration[handle.slot] != handle.generation) {
+            return -1;
+        }
+        return indexOfSlot[handle.slot];
+    }
+    bool isValid(CritterHandle handle) const { return resolve(handle) >= 0; }
+    // Handle for the critter currently at a dense index
+    CritterHandle handleAt(std::size_t index) const {
+        std::uint32_t slot = slotOfIndex[index];
+        return CritterHandle{slot, slotGeneration[slot]};
+    }
+
+    // Per-critter accessors by dense index
+    float getX(std::size_t index) const { return posX[index]; }
+    float getY(std::size_t index) const { return posY[index]; }
+    sf::Vector2f getPosition(std::size_t index) const { return sf::Vector2f(posX[index], posY[index]); }
+    // Blends the position before and after the last update; alpha 0 = before, 1 = after
+    sf::Vector2f getInterpolatedPosition(std::size_t index, float alpha) const {
+        return sf::Vector2f(prevX[index] + (posX[index] - prevX[index]) * alpha,
+                            prevY[index] + (posY[index] - prevY[index]) * alpha);
+    }
+    // Returns the on-screen bounds used for mouse inspection
+    sf::FloatRect getBounds(std::size_t index) const {
+        return sf::FloatRect(getPosition(index), sf::Vector2f(SPRITE_SIZE, SPRITE_SIZE));
+    }
+    // Returns the index of the waypoint the critter is moving towards
+    int getCurrentWaypoint(std::size_t index) const { return waypoint[index]; }
+    // Returns the distance travelled along the path, in pixels
+    float getDistanceTravelled(std::size_t index) const { return distance[index]; }
+    // Returns the fraction of the path covered, 0 at the start and 1 at the exit
+    float getProgress(std::size_t index) const {
+        return pathLength > 0.0f ? distance[index] / pathLength : 0.0f;
+    }
+    // Total length of the path critters are following
+    float getPathLength() const { return pathLength; }
+    float getHealth(std::size_t index) const { return health[index]; }
+    float getSpeed(std::size_t index) const { return speed[index]; }
+    int getReward(std::size_t index) const { return reward[index]; }
+    float getFlashTimer(std::size_t index) const { return flashTimer[index]; }
+    CritterTypeId getTypeId(std::size_t index) const { return typeId[index]; }
+    bool hasFlag(std::size_t index, Flag flag) const { return (flags[index] & flag) != 0; }
+    bool isDead(std::size_t index) const { return hasFlag(index, DEAD); }
+    bool hasReachedEnd(std::size_t index) const { return hasFlag(index, REACHED_END); }
+    // Get maximum health for this critter type
+    float getMaxHealth(std::size_t index) const {
+        return CritterTypeRegistry::instance().get(typeId[index]).maxHealth;
+    }
+
+    // Raw contiguous arrays for tight loops
+    const float* getXData() const { return posX.data(); }
+    const float* getYData() const { return posY.data(); }
+    const float* getDistanceData() const { return distance.data(); }
+    const float* getHealthData() const { return health.data(); }
+    const std::uint8_t* getFlagData() const { return flags.data(); }
+
+private:
+    // Every array below counts toward the critters' memory tag
+    template <typename T>
+    using Field = TrackedVector<T, MemoryTag::CRITTERS>;
+
+    // Per-critter fields, all indexed densely [0, size())
+    Field<float> posX;
+    Field<float> posY;
+    // Positions before the last update, for render interpolation
+    Field<float> prevX;
+    Field<float> prevY;
+    Field<int> waypoint;
+    Field<float> distance;
+    Field<float> health;
+    Field<float> speed;
+    Field<float> flashTimer;
+    Field<int> reward;
+    Field<CritterTypeId> typeId;
+    Field<std::uint8_t> flags;
+
+    // Dense index <-> slot mapping. Freed slots are reused; bumping their
+    // generation on removal invalidates every outstanding handle to them.
+    Field<std::uint32_t> slotOfIndex;
+    Field<int> indexOfSlot;
+    Field<std::uint32_t> slotGeneration;
+    Field<std::uint32_t> freeSlots;
+    void releaseSlot(std::uint32_t slot);
+
+    // Length of the path passed to the last update()
+    float pathLength = 0.0f;
+
+    // Grid of dense indices; stale after any move, spawn or removal
+    SpatialHash grid{CELL_SIZE};
+    bool spatialIndexDirty = true;
+};
+
+#endif // CRITTERSTORE_HPP
@@ -0,0 +1,49 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * CritterTypeRegistry.cpp - Per-type critter data tables implementation
+ *
+ * Purpose: Registers the built-in critter types and resolves type textures
+ * lazily so the headless core never touches the disk.
+ *
+ * Dependencies: CritterTypeRegistry.hpp, limits, stdexcept
+ */
+
+/**
+ * @file CritterTypeRegistry.cpp
+ * @brief Implementation of the Critter Type Registry
+ */
+
+#include "CritterTypeRegistry.hpp"
+#include <limits>
+#include <stdexcept>
+
+CritterTypeRegistry& CritterTypeRegistry::instance() {
+    static CritterTypeRegistry registry;
+    return registry;
+}
+
+CritterTypeRegistry::CritterTypeRegistry() {
+    // Max health values approximate each type's base health in the wave factories
+    registerType({"Normal", "textures/critter.png", 1, 100.0f + 10.0f, 10, 1, 1.0f});
+    registerType({"Medium", "textures/critter2.png", 2, 200.0f + 25.0f, 50, 2, 1.0f});
+    registerType({"Strong", "textures/critter3.png", 3, 800.0f + 200.0f, 100, 3, 12.0f});
+}
+
+CritterTypeId CritterTypeRegistry::registerType(const CritterTypeInfo& info) {
+    if (types.size() > std::numeric_limits<CritterTypeId>::max()) {
+        throw std::runtime_error("ERROR: Too many critter types registered");
+    }
+    types.push_back(info);
+    textures.emplace_back();
+    return static_cast<CritterTypeId>(types.size() - 1);
+}
+
+const sf::Texture& CritterTypeRegistry::getTexture(CritterTypeId id) {
+    TextureCache::Handle& texture = textures[id];
+    if (!texture) {
+        texture = TextureCache::instance().acquire(types[id].texturePath);
+    }
+    return *texture;
+}
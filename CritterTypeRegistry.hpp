@@ -0,0 +1,69 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * CritterTypeRegistry.hpp - Per-type critter data tables
+ *
+ * Purpose: Gives every critter type a small integer id and keeps the data
+ * that depends only on the type (display name, base max health, leak
+ * penalties, special-tower multiplier, texture) in a table indexed by it.
+ * Texture paths are only looked at when the table is built; gameplay code
+ * compares and indexes by id.
+ *
+ * Dependencies: TextureCache, vector, string, cstdint
+ */
+/**
+ * @file CritterTypeRegistry.hpp
+ * @brief Implementation of Critter Type Registry header file
+ */
+
+#ifndef CRITTERTYPEREGISTRY_HPP
+#define CRITTERTYPEREGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "TextureCache.hpp"
+
+using CritterTypeId = std::uint8_t;
+
+struct CritterTypeInfo {
+    std::string name;                 // Label shown in the tooltip
+    std::string texturePath;
+    int level = 1;                    // 1 basic, 2 medium, 3 strong
+    float maxHealth = 100.0f;         // Base health used to scale the health bar
+    int leakGoldPenalty = 0;          // Gold lost when the critter reaches the exit
+    int leakLifeCost = 1;             // Lives lost when the critter reaches the exit
+    float specialMultiplier = 1.0f;   // Damage multiplier applied by special towers
+};
+
+class CritterTypeRegistry {
+public:
+    // Ids of the built-in types, registered in this order
+    static constexpr CritterTypeId BASIC = 0;
+    static constexpr CritterTypeId MEDIUM = 1;
+    static constexpr CritterTypeId STRONG = 2;
+
+    // Process-wide registry, populated with the built-in types
+    static CritterTypeRegistry& instance();
+
+    // Adds a type and returns its id. Throws std::runtime_error once the id space is exhausted.
+    CritterTypeId registerType(const CritterTypeInfo& info);
+
+    const CritterTypeInfo& get(CritterTypeId id) const { return types[id]; }
+    std::size_t getTypeCount() const { return types.size(); }
+
+    // Texture for a type, fetched from the TextureCache on first use
+    const sf::Texture& getTexture(CritterTypeId id);
+
+private:
+    CritterTypeRegistry();
+    CritterTypeRegistry(const CritterTypeRegistry&) = delete;
+    CritterTypeRegistry& operator=(const CritterTypeRegistry&) = delete;
+
+    std::vector<CritterTypeInfo> types;
+    std::vector<TextureCache::Handle> textures;
+};
+
+#endif // CRITTERTYPEREGISTRY_HPP
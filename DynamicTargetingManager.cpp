@@ -7,7 +7,7 @@
  * Purpose: Implements the dynamic selection of targeting strategies based on
  * game conditions like critter health, position, and quantity.
  * 
- * Dependencies: DynamicTargetingManager.hpp, Tower, Critter
+ * Dependencies: DynamicTargetingManager.hpp, Tower, CritterStore
  */
 /**
  * @file DynamicTargetingManager.cpp
@@ -16,108 +16,66 @@
 
  #include "DynamicTargetingManager.hpp"
  #include "tower.hpp" // For Tower class access
- #include "Critter.hpp" // For Critter class access
  #include <cmath>
  
  DynamicTargetingManager::DynamicTargetingManager(Tower* towerPtr)
      : tower(towerPtr),
-       exitProximityStrategy(std::make_shared<ExitProximityStrategy>()),
-       strongestStrategy(std::make_shared<StrongestFirstStrategy>()),
-       weakestStrategy(std::make_shared<WeakestFirstStrategy>()),
-       closestStrategy(std::make_shared<ClosestFirstStrategy>()),
-       smartStrategy(std::make_shared<SmartTargetingStrategy>()),
        currentStrategyType(StrategyType::SMART)
  {
  }
  
- std::shared_ptr<TargetingStrategy> DynamicTargetingManager::selectStrategy(
-     const std::vector<std::unique_ptr<Critter>>& critters)
+ StrategyType DynamicTargetingManager::selectStrategy(
+     const CritterStore& critters,
+     const BattlefieldSummary& summary)
  {
      // If no critters, use default smart strategy
      if (critters.empty()) {
          currentStrategyType = StrategyType::SMART;
-         return smartStrategy;
+         return currentStrategyType;
      }
      
-     // Game state analysis variables
-     bool hasLevel3Critters = false;
-     bool hasNearExitCritters = false;
-     int crittersNearTower = 0;
-     int totalCritters = 0;
-     int maxWaypoint = 0;
-     
-     // Get tower position for distance calculations
-     sf::Vector2f towerPos = tower->getPosition();
-     float towerRange = tower->getRange();
-     
-     // First pass: find max waypoint to calculate exit proximity
-     for (const auto& critter : critters) {
-         if (critter->isDead()) continue;
-         
-         maxWaypoint = std::max(maxWaypoint, critter->getCurrentWaypoint());
-     }
-     
-     // If no valid waypoint info, use a default value
-     if (maxWaypoint == 0) {
-         maxWaypoint = 10; // Reasonable default
-     }
-     
-     // Second pass: analyze game state based on critters
-     for (const auto& critter : critters) {
-         if (critter->isDead()) continue;
-         
-         totalCritters++;
-         
-         // Check for special critters (Level 3)
-         if (critter->getTexturePath() == "textures/critter3.png") {
-             hasLevel3Critters = true;
-         }
-         
-         // Check for critters near the exit (in last 30% of path)
-         float progressRatio = static_cast<float>(critter->getCurrentWaypoint()) / maxWaypoint;
-         if (progressRatio > 0.7f) {
-             hasNearExitCritters = true;
-         }
-         
-         // Check for critters near this tower
-         sf::Vector2f critterPos = critter->getSprite().getPosition();
-         float distance = std::sqrt(
-             std::pow(towerPos.x - critterPos.x, 2.0f) + 
-             std::pow(towerPos.y - critterPos.y, 2.0f)
-         );
-         
-         if (distance <= towerRange) {
-             crittersNearTower++;
-         }
-     }
+     // Wave-wide conditions come from the per-tick summary
+     bool hasLevel3Critters = summary.level3Count > 0;
+     bool hasNearExitCritters = summary.hasNearExit;
+     int totalCritters = summary.aliveCount;
      
      // Strategy selection logic based on analyzed conditions
      if (hasLevel3Critters && tower->getTowerType() == Tower::Type::SPECIAL) {
          // Special towers should target level 3 critters
          currentStrategyType = StrategyType::STRONGEST;
-         return strongestStrategy;
+         return currentStrategyType;
      }
      else if (hasNearExitCritters) {
          // Critical situation: prioritize critters near exit
          currentStrategyType = StrategyType::EXIT_PROXIMITY;
-         return exitProximityStrategy;
+         return currentStrategyType;
      }
-     else if (crittersNearTower >= 5) {
+     else if (tower->getTowerType() == Tower::Type::AREA &&
+              totalCritters >= 5 && countCrittersInRange(critters) >= 5) {
          // Many critters in range: for area towers, target clusters
-         if (tower->getTowerType() == Tower::Type::AREA) {
-             currentStrategyType = StrategyType::CLOSEST;
-             return closestStrategy;
-         }
+         currentStrategyType = StrategyType::CLOSEST;
+         return currentStrategyType;
      }
      else if (totalCritters <= 3) {
          // Few critters: focus on strongest
          currentStrategyType = StrategyType::STRONGEST;
-         return strongestStrategy;
+         return currentStrategyType;
      }
      
      // Default behavior: use smart balanced strategy
      currentStrategyType = StrategyType::SMART;
-     return smartStrategy;
+     return currentStrategyType;
+ }
+ 
+ int DynamicTargetingManager::countCrittersInRange(const CritterStore& critters) const {
+     // Count critters near this tower through the spatial index
+     int crittersNearTower = 0;
+     critters.queryRadius(tower->getPosition(), tower->getRange(), [&](std::size_t i) {
+         if (!critters.isDead(i)) {
+             crittersNearTower++;
+         }
+     });
+     return crittersNearTower;
  }
  
  StrategyType DynamicTargetingManager::getCurrentStrategyType() const {
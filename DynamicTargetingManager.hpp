@@ -19,12 +19,11 @@
  
  #include "TargetingStrategy.hpp"
  #include "TargetingStrategyFactory.hpp"
- #include <memory>
- #include <vector>
+ #include "CritterStore.hpp"
+ #include "BattlefieldSummary.hpp"
  
  // Forward declarations
  class Tower;
- class Critter;
  
  /**
   * Manages the dynamic selection of targeting strategies for towers
@@ -41,11 +40,13 @@
      /**
       * Selects the most appropriate strategy based on current game conditions
       * 
-      * @param critters Vector of critters currently in play
-      * @return A shared pointer to the selected strategy
+      * @param critters Store of critters currently in play
+      * @param summary Wave-wide critter statistics for this tick
+      * @return The selected strategy type, for findTargetWith()
       */
-     std::shared_ptr<TargetingStrategy> selectStrategy(
-         const std::vector<std::unique_ptr<Critter>>& critters);
+     StrategyType selectStrategy(
+         const CritterStore& critters,
+         const BattlefieldSummary& summary);
          
      /**
       * Gets the current strategy type
@@ -55,12 +56,8 @@
  private:
      Tower* tower;
      
-     // Cache of strategy objects to avoid constant creation/destruction
-     std::shared_ptr<ExitProximityStrategy> exitProximityStrategy;
-     std::shared_ptr<StrongestFirstStrategy> strongestStrategy;
-     std::shared_ptr<WeakestFirstStrategy> weakestStrategy;
-     std::shared_ptr<ClosestFirstStrategy> closestStrategy;
-     std::shared_ptr<SmartTargetingStrategy> smartStrategy;
+     // Live critters within the tower's range, from a spatial query
+     int countCrittersInRange(const CritterStore& critters) const;
      
      // Tracks the current strategy for status reporting
      StrategyType currentStrategyType;
@@ -0,0 +1,116 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * FrameProfiler.cpp - Per-phase frame timing implementation
+ *
+ * Purpose: Implements the frame window bookkeeping and the rolling
+ * averages and maxima read by the performance overlay.
+ *
+ * Dependencies: FrameProfiler.hpp, algorithm
+ */
+
+/**
+ * @file FrameProfiler.cpp
+ * @brief Implements the process-wide frame profiler
+ */
+
+#include "FrameProfiler.hpp"
+#include <algorithm>
+
+FrameProfiler& FrameProfiler::instance() {
+    static FrameProfiler profiler;
+    return profiler;
+}
+
+void FrameProfiler::setEnabled(bool on) {
+    if (on && !enabled) {
+        next = 0;
+        filled = 0;
+    }
+    enabled = on;
+}
+
+void FrameProfiler::beginFrame() {
+    if (!enabled) return;
+    current.fill(Clock::duration::zero());
+    currentDrawCalls = 0;
+    frameStart = Clock::now();
+}
+
+void FrameProfiler::endFrame() {
+    if (!enabled) return;
+    frameHistory[next] = Clock::now() - frameStart;
+    phaseHistory[next] = current;
+    drawCallHistory[next] = currentDrawCalls;
+    next = (next + 1) % HISTORY;
+    filled = std::min(filled + 1, HISTORY);
+}
+
+double FrameProfiler::getAverageMs(FramePhase phase) const {
+    if (filled == 0) return 0.0;
+    Clock::duration total = Clock::duration::zero();
+    for (std::size_t i = 0; i < filled; ++i) {
+        total += phaseHistory[i][static_cast<std::size_t>(phase)];
+    }
+    return toMs(total) / filled;
+}
+
+double FrameProfiler::getMaxMs(FramePhase phase) const {
+    Clock::duration worst = Clock::duration::zero();
+    for (std::size_t i = 0; i < filled; ++i) {
+        worst = std::max(worst, phaseHistory[i][static_cast<std::size_t>(phase)]);
+    }
+    return toMs(worst);
+}
+
+double FrameProfiler::getAverageFrameMs() const {
+    if (filled == 0) return 0.0;
+    Clock::duration total = Clock::duration::zero();
+    for (std::size_t i = 0; i < filled; ++i) {
+        total += frameHistory[i];
+    }
+    return toMs(total) / filled;
+}
+
+double FrameProfiler::getMaxFrameMs() const {
+    Clock::duration worst = Clock::duration::zero();
+    for (std::size_t i = 0; i < filled; ++i) {
+        worst = std::max(worst, frameHistory[i]);
+    }
+    return toMs(worst);
+}
+
+double FrameProfiler::getAverageDrawCalls() const {
+    if (filled == 0) return 0.0;
+    double total = 0.0;
+    for (std::size_t i = 0; i < filled; ++i) {
+        total += drawCallHistory[i];
+    }
+    return total / filled;
+}
+
+std::uint32_t FrameProfiler::getMaxDrawCalls() const {
+    std::uint32_t worst = 0;
+    for (std::size_t i = 0; i < filled; ++i) {
+        worst = std::max(worst, drawCallHistory[i]);
+    }
+    return worst;
+}
+
+const char* FrameProfiler::getPhaseName(FramePhase phase) {
+    switch (phase) {
+        case FramePhase::INPUT: return "input";
+        case FramePhase::TOOLTIPS: return "tooltips";
+        case FramePhase::SPAWNER_UPDATE: return "spawner update";
+        case FramePhase::PROJECTILE_UPDATE: return "projectile update";
+        case FramePhase::TOWER_UPDATE: return "tower update";
+        case FramePhase::MAP_DRAW: return "map draw";
+        case FramePhase::TOWER_DRAW: return "tower draw";
+        case FramePhase::CRITTER_DRAW: return "critter draw";
+        case FramePhase::UI_DRAW: return "ui draw";
+        case FramePhase::SHOP_DRAW: return "shop draw";
+        case FramePhase::DISPLAY: return "display";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,131 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * FrameProfiler.hpp - Per-phase frame timing
+ *
+ * Purpose: Accumulates how long each phase of a frame takes (input,
+ * simulation subsystems, each draw pass, display) and how many draw calls
+ * were issued. It keeps a fixed window of recent frames for rolling averages
+ * and maxima. Storage is fixed size, so recording never allocates. Scopes
+ * also become trace events while the TraceRecorder is on. With both off, a
+ * scope costs two flag checks and reads no clock.
+ *
+ * Dependencies: TraceRecorder, array, chrono, cstdint
+ */
+/**
+ * @file FrameProfiler.hpp
+ * @brief Implementation of Frame Profiler header file
+ */
+
+#ifndef FRAMEPROFILER_HPP
+#define FRAMEPROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "TraceRecorder.hpp"
+
+enum class FramePhase : std::uint8_t {
+    INPUT,              // Window events, including tooltip building
+    TOOLTIPS,           // Tooltip text building (part of INPUT)
+    SPAWNER_UPDATE,
+    PROJECTILE_UPDATE,
+    TOWER_UPDATE,
+    MAP_DRAW,
+    TOWER_DRAW,         // Towers and projectiles
+    CRITTER_DRAW,
+    UI_DRAW,            // HUD text, buttons, tooltips, overlays and the shop
+    SHOP_DRAW,          // Shop panel (part of UI_DRAW)
+    DISPLAY,            // Buffer swap, including any wait for vsync
+    COUNT
+};
+
+class FrameProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(FramePhase::COUNT);
+    // Frames in the rolling window
+    static constexpr std::size_t HISTORY = 120;
+
+    // Process-wide profiler instance
+    static FrameProfiler& instance();
+
+    // Recording is off until enabled; turning it on starts a fresh window
+    void setEnabled(bool on);
+    bool isEnabled() const { return enabled; }
+
+    // Frame boundaries. endFrame() moves this frame's totals into the window.
+    void beginFrame();
+    void endFrame();
+
+    void addTime(FramePhase phase, Clock::duration elapsed) {
+        current[static_cast<std::size_t>(phase)] += elapsed;
+    }
+    void countDrawCalls(std::uint32_t count = 1) {
+        if (enabled) currentDrawCalls += count;
+    }
+
+    // Rolling statistics over the frames recorded so far (at most HISTORY)
+    std::size_t getFrameCount() const { return filled; }
+    double getAverageMs(FramePhase phase) const;
+    double getMaxMs(FramePhase phase) const;
+    double getAverageFrameMs() const;
+    double getMaxFrameMs() const;
+    double getAverageDrawCalls() const;
+    std::uint32_t getMaxDrawCalls() const;
+
+    static const char* getPhaseName(FramePhase phase);
+
+    // Times the enclosing block into one phase while the profiler is
+    // enabled, and traces it while the trace recorder is on
+    class Scope {
+    public:
+        explicit Scope(FramePhase phase)
+            : phase(phase)
+            , profiled(FrameProfiler::instance().isEnabled())
+            , traced(TraceRecorder::instance().isEnabled())
+        {
+            if (profiled || traced) start = Clock::now();
+        }
+        ~Scope() {
+            if (!profiled && !traced) return;
+            Clock::time_point end = Clock::now();
+            if (profiled) FrameProfiler::instance().addTime(phase, end - start);
+            if (traced) TraceRecorder::instance().record(getPhaseName(phase), "frame", start, end);
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        FramePhase phase;
+        bool profiled;
+        bool traced;
+        Clock::time_point start;
+    };
+
+private:
+    FrameProfiler() = default;
+
+    static double toMs(Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    bool enabled = false;
+
+    // Frame in progress
+    Clock::time_point frameStart;
+    std::array<Clock::duration, PHASE_COUNT> current{};
+    std::uint32_t currentDrawCalls = 0;
+
+    // Ring of the last HISTORY completed frames
+    std::array<std::array<Clock::duration, PHASE_COUNT>, HISTORY> phaseHistory{};
+    std::array<Clock::duration, HISTORY> frameHistory{};
+    std::array<std::uint32_t, HISTORY> drawCallHistory{};
+    std::size_t next = 0;
+    std::size_t filled = 0;
+};
+
+#endif // FRAMEPROFILER_HPP
@@ -0,0 +1,120 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * GameWorld.cpp - Headless simulation core implementation
+ * 
+ * Purpose: Builds the level and steps critters, towers and projectiles
+ * without any rendering.
+ * 
+ * Dependencies: GameWorld.hpp, FrameProfiler, TraceRecorder, CounterRegistry, chrono, cmath, stdexcept
+ */
+
+/**
+ * @file GameWorld.cpp
+ * @brief Implements the window-free simulation step
+ */
+
+#include "GameWorld.hpp"
+#include "FrameProfiler.hpp"
+#include "TraceRecorder.hpp"
+#include "CounterRegistry.hpp"
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+GameWorld::GameWorld(int selectedLevel, int mapWidth, int mapHeight)
+    : mapGen(selectedLevel, mapWidth, mapHeight)
+    , waypoints()
+    , pathLengths()
+    , spawner(waypoints, pathLengths)
+    , projectiles()
+    , towerManager(mapGen, spawner, projectiles)
+{
+}
+
+void GameWorld::build(sf::RenderWindow* editorWindow) {
+    mapGen.builder(editorWindow);
+    mapGen.flushNotifications();
+    waypoints = mapGen.getWaypoints(&pathLengths);
+    pathMemory.set(waypoints.capacity() * sizeof(sf::Vector2f) + pathLengths.capacity() * sizeof(float));
+
+    // Check if waypoints are valid
+    if (waypoints.empty()) {
+        throw std::runtime_error("ERROR: No waypoints generated! Exiting game.");
+    }
+}
+
+void GameWorld::step(float deltaTime) {
+    TraceScope trace("sim step", "frame");
+    CounterRegistry::add(Counter::SIM_STEPS);
+    if (!spawner.isGameOver()) {
+        {
+            FrameProfiler::Scope scope(FramePhase::SPAWNER_UPDATE);
+            spawner.update(deltaTime);
+        }
+        {
+            FrameProfiler::Scope scope(FramePhase::PROJECTILE_UPDATE);
+            projectiles.update(deltaTime);
+        }
+        {
+            FrameProfiler::Scope scope(FramePhase::TOWER_UPDATE);
+            towerManager.update(deltaTime);
+        }
+    }
+    flushNotifications();
+}
+
+int GameWorld::advance(float frameTime) {
+    using Clock = std::chrono::steady_clock;
+
+    // Frame and step durations are kept only while a wave is in flight
+    bool timed = !spawner.isWaveComplete();
+    if (timed) {
+        if (waveTimings.wave != spawner.getCurrentWave()) {
+            waveTimings.clear(spawner.getCurrentWave());
+        }
+        waveTimings.frames.record(static_cast<std::int64_t>(frameTime * 1e9));
+    }
+
+    accumulator += frameTime;
+
+    int steps = 0;
+    while (accumulator >= FIXED_TIMESTEP && steps < MAX_STEPS_PER_ADVANCE) {
+        Clock::time_point stepStart = timed ? Clock::now() : Clock::time_point();
+        step(FIXED_TIMESTEP);
+        if (timed) {
+            waveTimings.steps.record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - stepStart).count());
+        }
+        accumulator -= FIXED_TIMESTEP;
+        ++steps;
+    }
+
+    // Too far behind: drop the backlog instead of trying to catch up
+    if (accumulator >= FIXED_TIMESTEP) {
+        accumulator = std::fmod(accumulator, FIXED_TIMESTEP);
+    }
+
+    float alpha = getInterpolationAlpha();
+    spawner.setInterpolationAlpha(alpha);
+    towerManager.setInterpolationAlpha(alpha);
+
+    // Changes made by input handling between steps
+    flushNotifications();
+    return steps;
+}
+
+void GameWorld::flushNotifications() {
+    mapGen.flushNotifications();
+    spawner.flushNotifications();
+    towerManager.flushNotifications();
+}
+
+void GameWorld::reset() {
+    spawner.reset();
+    projectiles.clear();
+    towerManager.reset();
+    accumulator = 0.0f;
+    waveTimings.clear(0);
+}
@@ -0,0 +1,86 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * GameWorld.hpp - Headless simulation core
+ * 
+ * Purpose: Owns the map, critter spawner, towers, projectiles and the
+ * player economy, and advances them with step(). Never opens a window or decodes
+ * a texture, so it can run on machines without a display.
+ * 
+ * Dependencies: SFML 3.0, MapGenerator, CritterSpawner, ProjectileSystem, TowerManager, LatencyHistogram, MemoryTracker
+ */
+/**
+ * @file GameWorld.hpp
+ * @brief Implementation of Game World header file
+ */
+
+#ifndef GAMEWORLD_HPP
+#define GAMEWORLD_HPP
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "MapGenerator.h"
+#include "CritterSpawner.hpp"
+#include "ProjectileSystem.hpp"
+#include "TowerManager.hpp"
+#include "LatencyHistogram.hpp"
+#include "MemoryTracker.hpp"
+
+class GameWorld {
+public:
+    // Creates an unbuilt world for the given level (4 = custom, sized by mapWidth x mapHeight)
+    GameWorld(int selectedLevel = 1, int mapWidth = 0, int mapHeight = 0);
+
+    // Builds the map and the critter path. Only the custom map editor needs a window.
+    void build(sf::RenderWindow* editorWindow = nullptr);
+
+    // Simulation rate: every step advances the world by exactly this much
+    static constexpr float FIXED_TIMESTEP = 1.0f / 120.0f;
+    // Most steps advance() may run per call, so a long stall can't snowball
+    static constexpr int MAX_STEPS_PER_ADVANCE = 8;
+
+    // Advances the simulation by deltaTime seconds (no-op once the game is over)
+    void step(float deltaTime);
+
+    // Adds frameTime of real time and runs as many fixed steps as it covers.
+    // Returns the number of steps run; leftover time carries to the next call.
+    // While a wave runs, frameTime and each step's duration go into getWaveTimings().
+    int advance(float frameTime);
+
+    // Fraction of a fixed step left in the accumulator, for render interpolation
+    float getInterpolationAlpha() const { return accumulator / FIXED_TIMESTEP; }
+
+    // Clears critters, towers and the economy back to their starting state
+    void reset();
+
+    MapGenerator& getMap() { return mapGen; }
+    CritterSpawner& getSpawner() { return spawner; }
+    TowerManager& getTowerManager() { return towerManager; }
+    ProjectileSystem& getProjectiles() { return projectiles; }
+    const std::vector<sf::Vector2f>& getWaypoints() const { return waypoints; }
+    // Path length from the first waypoint to each waypoint
+    const std::vector<float>& getPathLengths() const { return pathLengths; }
+    // Frame and step durations of the current wave, or of the last one once it ends
+    const WaveTimings& getWaveTimings() const { return waveTimings; }
+
+private:
+    // Delivers the coalesced change notifications of this tick
+    void flushNotifications();
+
+    MapGenerator mapGen;
+    // Declared before the spawner, which keeps references to them
+    std::vector<sf::Vector2f> waypoints;
+    std::vector<float> pathLengths;
+    MemoryAccount pathMemory{MemoryTag::MAP}; // Held by waypoints and pathLengths
+    CritterSpawner spawner;
+    ProjectileSystem projectiles;
+    TowerManager towerManager;
+
+    // Real time not yet simulated, always below FIXED_TIMESTEP after advance()
+    float accumulator = 0.0f;
+
+    WaveTimings waveTimings;
+};
+
+#endif // GAMEWORLD_HPP
@@ -0,0 +1,118 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * LatencyHistogram.cpp - Log-bucketed duration histogram implementation
+ *
+ * Purpose: Maps durations to buckets and back, finds percentiles, and
+ * formats per-wave timing reports.
+ *
+ * Dependencies: LatencyHistogram.hpp, algorithm, cstdio, ostream
+ */
+
+/**
+ * @file LatencyHistogram.cpp
+ * @brief Implements the log-bucketed duration histogram
+ */
+
+#include "LatencyHistogram.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <ostream>
+
+namespace {
+
+double toMs(std::int64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) / 1e6;
+}
+
+void writeSummary(std::ostream& out, const char* label, const LatencyHistogram& histogram) {
+    char line[160];
+    std::snprintf(line, sizeof(line),
+        "%s p50 %.3f ms, p95 %.3f ms, p99 %.3f ms, max %.3f ms (%llu samples)",
+        label,
+        toMs(histogram.getPercentile(0.50)), toMs(histogram.getPercentile(0.95)),
+        toMs(histogram.getPercentile(0.99)), toMs(histogram.getMax()),
+        static_cast<unsigned long long>(histogram.getCount()));
+    out << line;
+}
+
+void writeJson(std::ostream& out, const LatencyHistogram& histogram) {
+    char object[200];
+    std::snprintf(object, sizeof(object),
+        "{\"count\":%llu,\"p50_ms\":%.3f,\"p95_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f}",
+        static_cast<unsigned long long>(histogram.getCount()),
+        toMs(histogram.getPercentile(0.50)), toMs(histogram.getPercentile(0.95)),
+        toMs(histogram.getPercentile(0.99)), toMs(histogram.getMax()));
+    out << object;
+}
+
+} // namespace
+
+std::size_t LatencyHistogram::bucketFor(std::int64_t nanoseconds) {
+    if (nanoseconds < SUB_BUCKETS) {
+        return static_cast<std::size_t>(std::max<std::int64_t>(nanoseconds, 0));
+    }
+    auto value = static_cast<std::uint64_t>(nanoseconds);
+    int exponent = 63;
+    while (!(value >> exponent)) --exponent;
+    if (exponent >= MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    // The three bits below the leading one pick the bucket within the doubling
+    std::size_t sub = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return static_cast<std::size_t>(exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+std::int64_t LatencyHistogram::bucketUpperBound(std::size_t bucket) {
+    if (bucket < static_cast<std::size_t>(SUB_BUCKETS)) {
+        return static_cast<std::int64_t>(bucket);
+    }
+    int exponent = static_cast<int>(bucket / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+    std::int64_t sub = static_cast<std::int64_t>(bucket % SUB_BUCKETS);
+    return ((SUB_BUCKETS + sub + 1) << (exponent - SUB_BUCKET_BITS)) - 1;
+}
+
+void LatencyHistogram::record(std::int64_t nanoseconds) {
+    ++buckets[bucketFor(nanoseconds)];
+    ++count;
+    max = std::max(max, nanoseconds);
+}
+
+void LatencyHistogram::clear() {
+    buckets.fill(0);
+    count = 0;
+    max = 0;
+}
+
+std::int64_t LatencyHistogram::getPercentile(double fraction) const {
+    if (count == 0) return 0;
+
+    // Rank of the sample at this percentile, 1-based
+    auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(count) + 0.5);
+    rank = std::min(std::max<std::uint64_t>(rank, 1), count);
+
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(bucket), max);
+        }
+    }
+    return max;
+}
+
+void writeWaveTimingsSummary(std::ostream& out, const WaveTimings& timings) {
+    out << "Wave " << timings.wave << " timings: ";
+    writeSummary(out, "frame", timings.frames);
+    out << "; ";
+    writeSummary(out, "step", timings.steps);
+}
+
+void writeWaveTimingsJson(std::ostream& out, const WaveTimings& timings, const char* outcome) {
+    out << "{\"wave\":" << timings.wave << ",\"outcome\":\"" << outcome << "\",\"frames\":";
+    writeJson(out, timings.frames);
+    out << ",\"steps\":";
+    writeJson(out, timings.steps);
+    out << "}";
+}
@@ -0,0 +1,76 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * LatencyHistogram.hpp - Log-bucketed duration histogram
+ *
+ * Purpose: Counts durations in buckets that double in width every eight
+ * buckets, so any percentile is reported within 12.5% from 1 ns up to
+ * about 18 minutes. It uses a fixed array: recording is one
+ * increment and never allocates. WaveTimings pairs a histogram of frame
+ * times with one of simulation step times for a single wave.
+ *
+ * Dependencies: array, cstdint, iosfwd
+ */
+/**
+ * @file LatencyHistogram.hpp
+ * @brief Implementation of Latency Histogram header file
+ */
+
+#ifndef LATENCYHISTOGRAM_HPP
+#define LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+class LatencyHistogram {
+public:
+    // Buckets per doubling of duration
+    static constexpr int SUB_BUCKET_BITS = 3;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    // Durations at or above 2^MAX_EXPONENT ns land in the last bucket
+    static constexpr int MAX_EXPONENT = 40;
+    static constexpr std::size_t BUCKET_COUNT =
+        SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    void record(std::int64_t nanoseconds);
+    void clear();
+
+    std::uint64_t getCount() const { return count; }
+    std::int64_t getMax() const { return max; }
+    // Smallest bucket bound at or above the given fraction (0..1) of the
+    // samples, capped at the exact maximum; 0 when empty
+    std::int64_t getPercentile(double fraction) const;
+
+private:
+    static std::size_t bucketFor(std::int64_t nanoseconds);
+    // Largest duration that falls in the bucket
+    static std::int64_t bucketUpperBound(std::size_t bucket);
+
+    std::array<std::uint32_t, BUCKET_COUNT> buckets{};
+    std::uint64_t count = 0;
+    std::int64_t max = 0;
+};
+
+// Frame and simulation step durations collected while one wave was running
+struct WaveTimings {
+    int wave = 0;
+    LatencyHistogram frames;
+    LatencyHistogram steps;
+
+    void clear(int waveNumber) {
+        wave = waveNumber;
+        frames.clear();
+        steps.clear();
+    }
+};
+
+// One line with the p50, p95, p99 and max of both histograms, in ms
+void writeWaveTimingsSummary(std::ostream& out, const WaveTimings& timings);
+// One JSON object on a single line, for appending to a JSON Lines file.
+// outcome says how the wave ended, e.g. "complete" or "game over".
+void writeWaveTimingsJson(std::ostream& out, const WaveTimings& timings, const char* outcome);
+
+#endif // LATENCYHISTOGRAM_HPP
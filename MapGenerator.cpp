@@ -7,7 +7,7 @@
  * Purpose: Implements map creation, path generation, and handles
  * tile-based game environment setup and rendering.
  * 
- * Dependencies: SFML 3.0, MapGenerator.h, Tile.h, iostream, queue
+ * Dependencies: SFML 3.0, MapGenerator.h, Tile.h, FrameProfiler, TraceRecorder, iostream, queue
  */
 /**
  * @file MapGenerator.cpp
@@ -16,19 +16,24 @@
 
  #include "MapGenerator.h"
  #include "Tile.h"
+ #include "TextureCache.hpp"
+ #include "FrameProfiler.hpp"
+ #include "TraceRecorder.hpp"
  #include <iostream>
  #include <queue>
+ #include <cmath>
  #include <SFML/Graphics.hpp>
  #include <SFML/Window.hpp>
  
- MapGenerator::MapGenerator(int selectedLevel, int mapWidth, int mapHeight) {
+ MapGenerator::MapGenerator(int selectedLevel, int mapWidth, int mapHeight)
+     : Observable(Counter::NOTIFY_MAP) {
      srand(time(0)); // Seed the random number generator
      
      // Set level directly from parameter
      level = selectedLevel;
      
-     // For custom maps, use provided dimensions
-     if (level == 4) {
+     // For custom and synthetic maps, use provided dimensions
+     if (level == 4 || level == SYNTHETIC_LEVEL) {
          width = mapWidth;
          height = mapHeight;
      } else {
@@ -52,24 +57,17 @@
                  break;
          }
      }
+ }
  
- 
-     if (!pathTexture.loadFromFile("textures/dirt_path_top.png")) {
-         throw std::runtime_error("ERROR: Could not load textures/dirt_path_top.png");
-     }
-     pathTexture.setSmooth(true);
-     if (!sceneryTexture.loadFromFile("textures/grass_block_top.png")) {
-         throw std::runtime_error("ERROR: Could not load textures/grass_block_top.png");
-     }
-     sceneryTexture.setSmooth(true);
-     if (!beginningTexture.loadFromFile("textures/emerald_block.png")) {
-         throw std::runtime_error("ERROR: Could not load textures/emerald_block.png");
-     }
-    // beginningTexture.setSmooth(true); 
-     if (!endTexture.loadFromFile("textures/bricks.png")) {
-         throw std::runtime_error("ERROR: Could not load textures/bricks.png");
-     }
-     //endTexture.setSmooth(true);
+ void MapGenerator::loadTextures() {
+     if (pathTexture) return;
+
+     TraceScope trace("map textures", "startup");
+     TextureCache& cache = TextureCache::instance();
+     pathTexture = cache.acquire("textures/dirt_path_top.png", true);
+     sceneryTexture = cache.acquire("textures/grass_block_top.png", true);
+     beginningTexture = cache.acquire("textures/emerald_block.png");
+     endTexture = cache.acquire("textures/bricks.png");
  }
  
  int MapGenerator::getWidth() {
@@ -84,83 +82,83 @@
  void MapGenerator::loadPresetLevel() {
      switch(level) {
          case 1: // Easy level (18x18)
-             gameMap[1][0] = Tile(1,0,Tile::TileType::Beginning);
-             gameMap[1][1] = Tile(1,1,Tile::TileType::Path);
-             gameMap[1][2] = Tile(1,2,Tile::TileType::Path);
+             tiles.set(0, 1, Tile::TileType::Beginning);
+             tiles.set(1, 1, Tile::TileType::Path);
+             tiles.set(2, 1, Tile::TileType::Path);
              for (int i = 2; i < 17; i++) {
-                 gameMap[i][2] = Tile(i,2,Tile::TileType::Path);
+                 tiles.set(2, i, Tile::TileType::Path);
              }
-             gameMap[16][3] = Tile(16,3,Tile::TileType::Path);
-             gameMap[16][4] = Tile(16,4,Tile::TileType::Path);
-             gameMap[16][5] = Tile(16,5,Tile::TileType::Path);
+             tiles.set(3, 16, Tile::TileType::Path);
+             tiles.set(4, 16, Tile::TileType::Path);
+             tiles.set(5, 16, Tile::TileType::Path);
              for (int i = 16; i > 0; i--) {
-                 gameMap[i][5] = Tile(i,5,Tile::TileType::Path);
+                 tiles.set(5, i, Tile::TileType::Path);
              }
-             gameMap[1][6] = Tile(1,6,Tile::TileType::Path);
-             gameMap[1][7] = Tile(1,7,Tile::TileType::Path);
-             gameMap[1][8] = Tile(1,8,Tile::TileType::Path);
+             tiles.set(6, 1, Tile::TileType::Path);
+             tiles.set(7, 1, Tile::TileType::Path);
+             tiles.set(8, 1, Tile::TileType::Path);
              for (int i = 2; i < 17; i++) {
-                 gameMap[i][8] = Tile(i,8,Tile::TileType::Path);
+                 tiles.set(8, i, Tile::TileType::Path);
              }
-             gameMap[16][9] = Tile(16,9,Tile::TileType::Path);
-             gameMap[16][10] = Tile(16,10,Tile::TileType::Path);
-             gameMap[16][11] = Tile(16,11,Tile::TileType::Path);
+             tiles.set(9, 16, Tile::TileType::Path);
+             tiles.set(10, 16, Tile::TileType::Path);
+             tiles.set(11, 16, Tile::TileType::Path);
              for (int i = 16; i > 0; i--) {
-                 gameMap[i][11] = Tile(i,11,Tile::TileType::Path);
+                 tiles.set(11, i, Tile::TileType::Path);
              }
-             gameMap[1][12] = Tile(1,12,Tile::TileType::Path);
-             gameMap[1][13] = Tile(1,13,Tile::TileType::Path);
-             gameMap[1][14] = Tile(1,14,Tile::TileType::Path);
+             tiles.set(12, 1, Tile::TileType::Path);
+             tiles.set(13, 1, Tile::TileType::Path);
+             tiles.set(14, 1, Tile::TileType::Path);
              for (int i = 2; i < 17; i++) {
-                 gameMap[i][14] = Tile(i,14,Tile::TileType::Path);
+                 tiles.set(14, i, Tile::TileType::Path);
              }
-             gameMap[16][15] = Tile(16,15,Tile::TileType::Path);
-             gameMap[16][16] = Tile(16,16,Tile::TileType::Path);
-             gameMap[width-2][height-1] = Tile(width-2,height-1,Tile::TileType::End);
+             tiles.set(15, 16, Tile::TileType::Path);
+             tiles.set(16, 16, Tile::TileType::Path);
+             tiles.set(height-1, width-2, Tile::TileType::End);
              break;
              
          case 2: // Normal level (12x12)
-             gameMap[1][0] = Tile(1,0,Tile::TileType::Beginning);
-             gameMap[1][1] = Tile(1,1,Tile::TileType::Path);
-             gameMap[1][2] = Tile(1,2,Tile::TileType::Path);
+             tiles.set(0, 1, Tile::TileType::Beginning);
+             tiles.set(1, 1, Tile::TileType::Path);
+             tiles.set(2, 1, Tile::TileType::Path);
              for (int i = 2; i < 11; i++) {
-                 gameMap[i][2] = Tile(i,2,Tile::TileType::Path);
+                 tiles.set(2, i, Tile::TileType::Path);
              }
-             gameMap[10][3] = Tile(10,3,Tile::TileType::Path);
-             gameMap[10][4] = Tile(10,4,Tile::TileType::Path);
-             gameMap[10][5] = Tile(10,5,Tile::TileType::Path);
+             tiles.set(3, 10, Tile::TileType::Path);
+             tiles.set(4, 10, Tile::TileType::Path);
+             tiles.set(5, 10, Tile::TileType::Path);
              for (int i = 10; i > 0; i--) {
-                 gameMap[i][5] = Tile(i,5,Tile::TileType::Path);
+                 tiles.set(5, i, Tile::TileType::Path);
              }
-             gameMap[1][6] = Tile(1,6,Tile::TileType::Path);
-             gameMap[1][7] = Tile(1,7,Tile::TileType::Path);
-             gameMap[1][8] = Tile(1,8,Tile::TileType::Path);
+             tiles.set(6, 1, Tile::TileType::Path);
+             tiles.set(7, 1, Tile::TileType::Path);
+             tiles.set(8, 1, Tile::TileType::Path);
              for (int i = 2; i < 11; i++) {
-                 gameMap[i][8] = Tile(i,8,Tile::TileType::Path);
+                 tiles.set(8, i, Tile::TileType::Path);
              }
-             gameMap[10][9] = Tile(10,9,Tile::TileType::Path);
-             gameMap[10][10] = Tile(10,10,Tile::TileType::Path);
-             gameMap[width-2][height-1] = Tile(width-2,height-1,Tile::TileType::End);
+             tiles.set(9, 10, Tile::TileType::Path);
+             tiles.set(10, 10, Tile::TileType::Path);
+             tiles.set(height-1, width-2, Tile::TileType::End);
              break;
              
          case 3: // Hard level (8x8)
-         gameMap[1][0] = Tile(1,0,Tile::TileType::Beginning);
-         gameMap[1][1] = Tile(1,1,Tile::TileType::Path);
-         gameMap[1][2] = Tile(1,2,Tile::TileType::Path);
-         gameMap[1][3] = Tile(1,3,Tile::TileType::Path);
-         gameMap[1][4] = Tile(1,4,Tile::TileType::Path);
-         gameMap[1][5] = Tile(1,5,Tile::TileType::Path);
-         gameMap[1][6] = Tile(1,6,Tile::TileType::Path);
+         tiles.set(0, 1, Tile::TileType::Beginning);
+         tiles.set(1, 1, Tile::TileType::Path);
+         tiles.set(2, 1, Tile::TileType::Path);
+         tiles.set(3, 1, Tile::TileType::Path);
+         tiles.set(4, 1, Tile::TileType::Path);
+         tiles.set(5, 1, Tile::TileType::Path);
+         tiles.set(6, 1, Tile::TileType::Path);
          
          // Right turn to form the L shape
-         gameMap[2][6] = Tile(2,6,Tile::TileType::Path);
-         gameMap[3][6] = Tile(3,6,Tile::TileType::Path);
-         gameMap[4][6] = Tile(4,6,Tile::TileType::Path);
-         gameMap[5][6] = Tile(5,6,Tile::TileType::Path);
-         gameMap[6][6] = Tile(6,6,Tile::TileType::Path);
+         tiles.set(6, 2, Tile::TileType::Path);
+         tiles.set(6, 3, Tile::TileType::Path);
+         tiles.set(6, 4, Tile::TileType::Path);
+         tiles.set(6, 5, Tile::TileType::Path);
+         tiles.set(6, 6, Tile::TileType::Path);
          
          // End tile
-         gameMap[width-2][height-1] = Tile(width-2,height-1,Tile::TileType::End);
+         tiles.set(height-1, width-2, Tile::TileType::End);
          
          // Debug print to verify end tile position
          std::cout << "Hard level end tile position: (" << width-2 << "," << height-1 << ")" << std::endl;
@@ -175,7 +173,7 @@
      return x >= 0 && x < width && y >= 0 && y < height;
  }
  
- std::vector<sf::Vector2f> MapGenerator::getWaypoints() const {
+ std::vector<sf::Vector2f> MapGenerator::getWaypoints(std::vector<float>* cumulativeLengths) const {
      std::vector<sf::Vector2f> waypoints;
      
      // First, find the beginning tile
@@ -184,7 +182,7 @@
      // Find the starting position
      for (int y = 0; y < height; y++) {
          for (int x = 0; x < width; x++) {
-             if (gameMap[y][x].getType() == Tile::TileType::Beginning) {
+             if (tiles.get(x, y) == Tile::TileType::Beginning) {
                  currentPos = sf::Vector2i(x, y);
                  waypoints.push_back(sf::Vector2f(
                      x * TILE_SIZE + TILE_SIZE / 2.f,
@@ -206,8 +204,8 @@
      };
      
      // Keep track of visited tiles to prevent loops
-     std::vector<std::vector<bool>> visited(height, std::vector<bool>(width, false));
-     visited[currentPos.y][currentPos.x] = true;
+     std::vector<bool> visited(static_cast<std::size_t>(width) * height, false);
+     visited[currentPos.y * width + currentPos.x] = true;
      
      // Follow the path
      bool foundEnd = false;
@@ -219,8 +217,8 @@
              sf::Vector2i nextPos = sf::Vector2i(currentPos.x + dir.x, currentPos.y + dir.y);
              
              // Check if position is within bounds
-             if (isValidTile(nextPos.x, nextPos.y) && !visited[nextPos.y][nextPos.x]) {
-                 Tile::TileType tileType = gameMap[nextPos.y][nextPos.x].getType();
+             if (isValidTile(nextPos.x, nextPos.y) && !visited[nextPos.y * width + nextPos.x]) {
+                 Tile::TileType tileType = tiles.get(nextPos.x, nextPos.y);
                  
                  if (tileType == Tile::TileType::Path || tileType == Tile::TileType::End) {
                      // Add waypoint
@@ -229,7 +227,7 @@
                          nextPos.y * TILE_SIZE + TILE_SIZE / 2.f
                      ));
                      
-                     visited[nextPos.y][nextPos.x] = true;
+                     visited[nextPos.y * width + nextPos.x] = true;
                      currentPos = nextPos;
                      foundNext = true;
                      
@@ -245,6 +243,16 @@
              throw std::runtime_error("Path is broken or does not reach the end!");
          }
      }
+
+     // Arc length of the path up to each waypoint
+     if (cumulativeLengths) {
+         cumulativeLengths->assign(waypoints.size(), 0.0f);
+         for (std::size_t i = 1; i < waypoints.size(); ++i) {
+             sf::Vector2f segment = waypoints[i] - waypoints[i - 1];
+             (*cumulativeLengths)[i] = (*cumulativeLengths)[i - 1] +
+                 std::sqrt(segment.x * segment.x + segment.y * segment.y);
+         }
+     }
      
      return waypoints;
  }
@@ -255,6 +263,12 @@
      if (level == 4) {  
          // Interactive map creation: pass the pointer, not the object.
          interactiveMapCreation(win);
+     } else if (level == SYNTHETIC_LEVEL) {
+         if (width < 8 || height < 8) {
+             throw std::runtime_error("Synthetic maps must be at least 8x8");
+         }
+         tiles.reset(width, height, Tile::TileType::Scenery);
+         generateSerpentineLevel();
      } else {
          // Existing preset level logic
          switch(level) {
@@ -274,28 +288,31 @@
                  throw std::runtime_error("Invalid level selection");
          }
          
-         gameMap.resize(height, std::vector<Tile>(width));
- 
-         // Set x, y coordinates for each Tile
-         for (int i = 0; i < height; i++) {
-             for (int j = 0; j < width; j++) {
-                 gameMap[i][j] = Tile(j, i, Tile::TileType::Scenery);
-             }
-         }
+         // Start from an all-scenery map
+         tiles.reset(width, height, Tile::TileType::Scenery);
          
          loadPresetLevel();
      }
-     notify();
+     markMapChanged();
  }
  
  void MapGenerator::interactiveMapCreation(sf::RenderWindow* mapWindow) {
+    if (!mapWindow) {
+        throw std::runtime_error("The custom map editor requires a window");
+    }
+    TraceScope trace("map editor", "startup");
+    loadTextures();
+
     // Just add validation to ensure the values are in range
     if (width < 8 || width > 20) width = 10;
     if (height < 8 || height > 20) height = 10;
 
     // Initialize the instruction text
-    if (!font.openFromFile("fonts/arial.ttf")) {
-        throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+    {
+        TraceScope fontTrace("font load", "io", "fonts/arial.ttf");
+        if (!font.openFromFile("fonts/arial.ttf")) {
+            throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+        }
     }
     
     // Create the text object with the font
@@ -307,25 +324,14 @@
     currentCreationStep = MapCreationStep::PLACE_START;
     updateInstructionText(instructionText);
 
-    // Resize game map with scenery tiles and initialize with default Scenery tiles.
-    gameMap.resize(height, std::vector<Tile>(width));
-    for (int i = 0; i < height; i++) {
-        for (int j = 0; j < width; j++) {
-            gameMap[i][j] = Tile(j, i, Tile::TileType::Scenery);
-        }
-    }
+    // Resize game map and initialize it with default Scenery tiles.
+    tiles.reset(width, height, Tile::TileType::Scenery);
 
-    
-    // Prepare tile shapes
-    std::vector<std::vector<sf::RectangleShape>> tileShapes(height, std::vector<sf::RectangleShape>(width));
-    
-    // Initialize all tiles with the scenery texture
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            tileShapes[y][x].setTexture(&sceneryTexture);
-            tileShapes[y][x].setFillColor(sf::Color(200, 200, 200, 128));
-        }
-    }
+    // The editor draws the same cached tile layer as the game, dimmed and
+    // stretched over the whole window
+    tileTint = sf::Color(200, 200, 200, 128);
+    markMapChanged();
+    sf::RenderStates editorStates;
 
     
 
@@ -382,14 +388,9 @@
         float dynamicTileWidth = static_cast<float>(winSize.x) / static_cast<float>(width);
         float dynamicTileHeight = static_cast<float>(winSize.y) / static_cast<float>(height);
 
-        // Update each tile shape's size and position
-        for (int y = 0; y < height; y++) {
-            for (int x = 0; x < width; x++) {
-                sf::RectangleShape& tile = tileShapes[y][x];
-                tile.setSize(sf::Vector2f(dynamicTileWidth, dynamicTileHeight));
-                tile.setPosition(sf::Vector2f(x * dynamicTileWidth, y * dynamicTileHeight));
-            }
-        }
+        // Scale the tile layer from map pixels to the window
+        editorStates.transform = sf::Transform();
+        editorStates.transform.scale(sf::Vector2f(dynamicTileWidth / TILE_SIZE, dynamicTileHeight / TILE_SIZE));
 
         // Position the restart button in the top-right corner
         restartButton.setPosition(sf::Vector2f(
@@ -513,10 +514,10 @@ while (mapWindow->isOpen()) {
                     // Reset the map
                     for (int i = 0; i < height; i++) {
                         for (int j = 0; j < width; j++) {
-                            gameMap[i][j] = Tile(j, i, Tile::TileType::Scenery);
-                            tileShapes[i][j].setTexture(&sceneryTexture);
+                            tiles.set(j, i, Tile::TileType::Scenery);
                         }
                     }
+                    markMapChanged();
                     
                     // Reset tracking variables
                     startSet = false;
@@ -550,8 +551,8 @@ while (mapWindow->isOpen()) {
                     // Set start tile if not already set
                     if (!startSet) {
                         startPos = sf::Vector2i(xIndex, yIndex);
-                        tileShapes[yIndex][xIndex].setTexture(&beginningTexture);
-                        gameMap[yIndex][xIndex] = Tile(xIndex, yIndex, Tile::TileType::Beginning);
+                        tiles.set(xIndex, yIndex, Tile::TileType::Beginning);
+                        markMapChanged();
                         startSet = true;
                         // Update to next step
                         currentCreationStep = MapCreationStep::PLACE_END;
@@ -579,8 +580,8 @@ while (mapWindow->isOpen()) {
                         else {
                             // Accept the end position
                             endPos = potentialEndPos;
-                            tileShapes[yIndex][xIndex].setTexture(&endTexture);
-                            gameMap[yIndex][xIndex] = Tile(xIndex, yIndex, Tile::TileType::End);
+                            tiles.set(xIndex, yIndex, Tile::TileType::End);
+                            markMapChanged();
                             endSet = true;
                             
                             // Update to next step
@@ -591,9 +592,9 @@ while (mapWindow->isOpen()) {
                     }
                     else if (startSet && endSet) {
                         // Code to place path tiles
-                        if (gameMap[yIndex][xIndex].getType() == Tile::TileType::Scenery) {
-                            tileShapes[yIndex][xIndex].setTexture(&pathTexture);
-                            gameMap[yIndex][xIndex] = Tile(xIndex, yIndex, Tile::TileType::Path);
+                        if (tiles.get(xIndex, yIndex) == Tile::TileType::Scenery) {
+                            tiles.set(xIndex, yIndex, Tile::TileType::Path);
+                            markMapChanged();
                         }
                     }
                 }
@@ -627,12 +628,8 @@ while (mapWindow->isOpen()) {
     // Render everything
     mapWindow->clear(sf::Color::Black);
     
-    // Draw tile shapes
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            mapWindow->draw(tileShapes[y][x]);
-        }
-    }
+    // Draw the tiles
+    drawTiles(*mapWindow, editorStates);
     
     // Draw error message if active
     if (showErrorMessage) {
@@ -651,9 +648,14 @@ while (mapWindow->isOpen()) {
     }
 
     mapWindow->display();
-    notify();
+    // One coalesced notification per editor frame, only if a tile changed
+    flushNotifications();
 }
 
+    // The game draws the map at full brightness
+    tileTint = sf::Color::White;
+    markMapChanged();
+
     // After the loop, ensure that a valid map was created
     if (!startSet || !endSet || !validatePath()) {
         throw std::runtime_error("Invalid map creation");
@@ -693,10 +695,10 @@ while (mapWindow->isOpen()) {
  
  bool MapGenerator::findPath(sf::Vector2i start, sf::Vector2i end) const {
      // Simple breadth-first search to verify path exists
-     vector<vector<bool>> visited(height, vector<bool>(width, false));
+     vector<bool> visited(static_cast<std::size_t>(width) * height, false);
      queue<sf::Vector2i> q;
      q.push(start);
-     visited[start.y][start.x] = true;
+     visited[start.y * width + start.x] = true;
  
      vector<pair<int, int>> directions = {{0,1}, {1,0}, {0,-1}, {-1,0}};
  
@@ -712,11 +714,11 @@ while (mapWindow->isOpen()) {
  
              // Check bounds and valid movement
              if (nx >= 0 && nx < width && ny >= 0 && ny < height &&
-                 !visited[ny][nx] && 
-                 (gameMap[ny][nx].getType() == Tile::TileType::Path || 
-                     gameMap[ny][nx].getType() == Tile::TileType::End)) {
+                 !visited[ny * width + nx] && 
+                 (tiles.get(nx, ny) == Tile::TileType::Path || 
+                     tiles.get(nx, ny) == Tile::TileType::End)) {
                  q.push(sf::Vector2i(nx, ny));
-                 visited[ny][nx] = true;
+                 visited[ny * width + nx] = true;
              }
          }
      }
@@ -724,44 +726,112 @@ while (mapWindow->isOpen()) {
      return false;
  }
  
- void MapGenerator::draw(sf::RenderWindow& window) {
+ void MapGenerator::markMapChanged() {
+     tileLayerDirty = true;
+     notify();
+ }
+ 
+ const sf::Texture* MapGenerator::getTextureForTile(Tile::TileType type) const {
+     switch (type) {
+         case Tile::TileType::Path:
+             return pathTexture.get();
+         case Tile::TileType::Beginning:
+             return beginningTexture.get();
+         case Tile::TileType::End:
+             return endTexture.get();
+         default:
+             return sceneryTexture.get();
+     }
+ }
+ 
+ void MapGenerator::rebuildTileLayer() {
+     // Layer 0 is scenery, which is also what any other tile type draws as
+     const Tile::TileType layerTypes[TILE_TEXTURE_COUNT] = {
+         Tile::TileType::Scenery, Tile::TileType::Path,
+         Tile::TileType::Beginning, Tile::TileType::End
+     };
+     auto layerOf = [&](Tile::TileType tileType) {
+         for (int layer = 1; layer < TILE_TEXTURE_COUNT; layer++) {
+             if (tileType == layerTypes[layer]) return layer;
+         }
+         return 0;
+     };
+ 
+     // Count tiles per layer so each vertex array is sized exactly once
+     std::array<std::size_t, TILE_TEXTURE_COUNT> tileCounts{};
      for (int y = 0; y < height; y++) {
          for (int x = 0; x < width; x++) {
-             Tile::TileType tileType = gameMap[y][x].getType();
-             
-             // Get the appropriate texture based on tile type
-             const sf::Texture& texture = [&]() -> const sf::Texture& {
-                 switch (tileType) {
-                     case Tile::TileType::Path:
-                         return pathTexture;
-                     case Tile::TileType::Beginning:
-                         return beginningTexture;
-                     case Tile::TileType::End:
-                         return endTexture;
-                     default:
-                         return sceneryTexture;
-                 }
-             }();
-             
-             // Create sprite with the texture
-             sf::Sprite tileSprite(texture);
- 
-             // Scale and position the sprite
-             tileSprite.setScale(sf::Vector2f(
-                 TILE_SIZE / static_cast<float>(texture.getSize().x),
-                 TILE_SIZE / static_cast<float>(texture.getSize().y)
-             ));
-             
-             tileSprite.setPosition(sf::Vector2f(x * TILE_SIZE, y * TILE_SIZE));
-             window.draw(tileSprite);
+             tileCounts[layerOf(tiles.get(x, y))]++;
          }
      }
+ 
+     for (int layer = 0; layer < TILE_TEXTURE_COUNT; layer++) {
+         tileLayerTextures[layer] = getTextureForTile(layerTypes[layer]);
+         tileLayers[layer].setPrimitiveType(sf::PrimitiveType::Triangles);
+         tileLayers[layer].resize(tileCounts[layer] * 6);
+     }
+     tileLayerMemory.set(static_cast<std::size_t>(width) * height * 6 * sizeof(sf::Vertex));
+ 
+     // Two triangles per tile, stretching the whole texture over the tile
+     std::array<std::size_t, TILE_TEXTURE_COUNT> nextVertex{};
+     for (int y = 0; y < height; y++) {
+         for (int x = 0; x < width; x++) {
+             int layer = layerOf(tiles.get(x, y));
+ 
+             sf::Vector2f texSize(tileLayerTextures[layer]->getSize());
+             float left = static_cast<float>(x * TILE_SIZE);
+             float top = static_cast<float>(y * TILE_SIZE);
+             float right = left + TILE_SIZE;
+             float bottom = top + TILE_SIZE;
+ 
+             sf::Vertex* quad = &tileLayers[layer][nextVertex[layer]];
+             nextVertex[layer] += 6;
+             quad[0].position = sf::Vector2f(left, top);
+             quad[1].position = sf::Vector2f(right, top);
+             quad[2].position = sf::Vector2f(left, bottom);
+             quad[3].position = sf::Vector2f(left, bottom);
+             quad[4].position = sf::Vector2f(right, top);
+             quad[5].position = sf::Vector2f(right, bottom);
+             quad[0].texCoords = sf::Vector2f(0.f, 0.f);
+             quad[1].texCoords = sf::Vector2f(texSize.x, 0.f);
+             quad[2].texCoords = sf::Vector2f(0.f, texSize.y);
+             quad[3].texCoords = sf::Vector2f(0.f, texSize.y);
+             quad[4].texCoords = sf::Vector2f(texSize.x, 0.f);
+             quad[5].texCoords = sf::Vector2f(texSize.x, texSize.y);
+             for (int corner = 0; corner < 6; corner++) {
+                 quad[corner].color = tileTint;
+             }
+         }
+     }
+ 
+     tileLayerDirty = false;
+ }
+ 
+ void MapGenerator::draw(sf::RenderWindow& window) {
+     drawTiles(window, sf::RenderStates::Default);
+ }
+
+ void MapGenerator::drawTiles(sf::RenderWindow& window, sf::RenderStates states) {
+     loadTextures();
+     if (tileLayerDirty) {
+         rebuildTileLayer();
+     }
+ 
+     std::uint32_t drawCalls = 0;
+     for (int layer = 0; layer < TILE_TEXTURE_COUNT; layer++) {
+         if (tileLayers[layer].getVertexCount() == 0) continue;
+ 
+         states.texture = tileLayerTextures[layer];
+         window.draw(tileLayers[layer], states);
+         drawCalls++;
+     }
+     FrameProfiler::instance().countDrawCalls(drawCalls);
  }
  
  void MapGenerator::printer() {
-     for (const auto &row : gameMap) {
-         for (Tile cell : row) {
-             switch(cell.getType()) {
+     for (int y = 0; y < height; y++) {
+         for (int x = 0; x < width; x++) {
+             switch(tiles.get(x, y)) {
                  case Tile::TileType::Path: 
                      cout << "|P|";
                      break;
@@ -783,6 +853,31 @@ while (mapWindow->isOpen()) {
      }
  }
  
+ void MapGenerator::generateSerpentineLevel() {
+     // Horizontal lanes every LANE_SPACING rows, joined by vertical runs at
+     // alternating ends. Three scenery rows separate neighbouring lanes.
+     const int LANE_SPACING = 4;
+     const int lastLane = 1 + ((height - 3) / LANE_SPACING) * LANE_SPACING;
+
+     bool goingRight = true;
+     for (int row = 1; row <= lastLane; row += LANE_SPACING) {
+         for (int x = 1; x <= width - 2; x++) {
+             tiles.set(x, row, Tile::TileType::Path);
+         }
+         if (row < lastLane) {
+             int column = goingRight ? width - 2 : 1;
+             for (int y = row + 1; y < row + LANE_SPACING; y++) {
+                 tiles.set(column, y, Tile::TileType::Path);
+             }
+         }
+         goingRight = !goingRight;
+     }
+
+     tiles.set(0, 1, Tile::TileType::Beginning);
+     // The last lane exits on the side it was heading towards
+     tiles.set(goingRight ? 0 : width - 1, lastLane, Tile::TileType::End);
+ }
+
  void MapGenerator::picker(char direction) {
      if (direction == 'N') {
          startPos = {0, rand() % (width - 2) + 1};
@@ -798,8 +893,8 @@ while (mapWindow->isOpen()) {
          startPos = {rand() % (height - 2) + 1, 0};
      }
      
-     gameMap[startPos.first][startPos.second] = Tile(startPos.first, startPos.second, Tile::TileType::Beginning);
-     gameMap[endPos.first][endPos.second] = Tile(endPos.first, endPos.second, Tile::TileType::End);
+     tiles.set(startPos.second, startPos.first, Tile::TileType::Beginning);
+     tiles.set(endPos.second, endPos.first, Tile::TileType::End);
  }
  
  void MapGenerator::pathGenerator() {
@@ -814,10 +909,9 @@ while (mapWindow->isOpen()) {
          }
          
          // Set current position to path if it's not start or end
-         if (gameMap[currentPos.first][currentPos.second].getType() != Tile::TileType::End && 
-             gameMap[currentPos.first][currentPos.second].getType() != Tile::TileType::Beginning) {
-             gameMap[currentPos.first][currentPos.second] = 
-                 Tile(currentPos.first, currentPos.second, Tile::TileType::Path);
+         if (tiles.get(currentPos.second, currentPos.first) != Tile::TileType::End && 
+             tiles.get(currentPos.second, currentPos.first) != Tile::TileType::Beginning) {
+             tiles.set(currentPos.second, currentPos.first, Tile::TileType::Path);
          }
          
          // Move horizontally towards end
@@ -828,10 +922,9 @@ while (mapWindow->isOpen()) {
          }
          
          // Set current position to path if it's not start or end
-         if (gameMap[currentPos.first][currentPos.second].getType() != Tile::TileType::End && 
-             gameMap[currentPos.first][currentPos.second].getType() != Tile::TileType::Beginning) {
-             gameMap[currentPos.first][currentPos.second] = 
-                 Tile(currentPos.first, currentPos.second, Tile::TileType::Path);
+         if (tiles.get(currentPos.second, currentPos.first) != Tile::TileType::End && 
+             tiles.get(currentPos.second, currentPos.first) != Tile::TileType::Beginning) {
+             tiles.set(currentPos.second, currentPos.first, Tile::TileType::Path);
          }
      }
  }
\ No newline at end of file
@@ -7,7 +7,7 @@
  * Purpose: Creates and manages game maps, handles path generation,
  * and provides tile-based navigation for enemies.
  * 
- * Dependencies: SFML 3.0, Tile, Observer.hpp
+ * Dependencies: SFML 3.0, Tile, TileGrid, Observer.hpp, MemoryTracker
  */
 /**
  * @file MapGenerator.h
@@ -19,22 +19,32 @@
  #include <SFML/Graphics.hpp>
  #include <iostream>
  #include <vector>
+ #include <array>
  #include <cstdlib>
  #include <ctime>
  #include "Tile.h"
+ #include "TileGrid.hpp"
  #include "Observer.hpp"
+ #include "TextureCache.hpp"
+ #include "MemoryTracker.hpp"
  
  class MapGenerator : public Observable {
  public:
      MapGenerator(int selectedLevel = 1, int mapWidth = 0, int mapHeight = 0);
+
+     // Level number of the generated mapWidth x mapHeight serpentine map, which
+     // builds without a window at any size (used for large benchmark maps)
+     static constexpr int SYNTHETIC_LEVEL = 5;
  
-     // Build internal 2D map array
-     void builder(sf::RenderWindow* win);   // Initialize map array
+     // Build internal 2D map array. Preset levels need no window; the
+     // custom map editor (level 4) runs its own UI loop in win.
+     void builder(sf::RenderWindow* win = nullptr);   // Initialize map array
  
-     // Get waypoints for critter pathing
-     std::vector<sf::Vector2f> getWaypoints() const; // Path points for critters
+     // Get waypoints for critter pathing. If cumulativeLengths is given it is
+     // filled with the path length from the first waypoint to each waypoint.
+     std::vector<sf::Vector2f> getWaypoints(std::vector<float>* cumulativeLengths = nullptr) const; // Path points for critters
  
-     // Draw the tiles to the window
+     // Draw the tiles to the window from the cached tile layer
      void draw(sf::RenderWindow& window);
      
      void printer(); // Debug print of map
@@ -48,7 +58,8 @@
      bool isValidMap() const;
      bool findPath(sf::Vector2i start, sf::Vector2i end) const;
      
-     vector<vector<Tile>> getMap() const { return gameMap; }
+     // Read-only view of the packed tile grid (no copy)
+     const TileGrid& getMap() const { return tiles; }
  
      // Get required window size based on map dimensions
      sf::Vector2u getRequiredWindowSize() const {
@@ -72,19 +83,33 @@
 
     bool arePositionsAdjacent(const sf::Vector2i& pos1, const sf::Vector2i& pos2) const;
     
-     // Our "map" is rows × columns of tiles
-     std::vector<std::vector<Tile>> gameMap;
+     // Our "map" is rows × columns of tiles, packed row-major
+     TileGrid tiles;
      const sf::Texture* getTextureForTile(Tile::TileType type) const;
-     // Textures for drawing each tile type
-     sf::Texture pathTexture;
-     sf::Texture sceneryTexture;
-     sf::Texture beginningTexture;
-     sf::Texture endTexture;
+     
+     // Cached tile layer: one triangle list per tile texture, so the whole map
+     // takes TILE_TEXTURE_COUNT draw calls. Rebuilt only after the map changes.
+     static const int TILE_TEXTURE_COUNT = 4;
+     std::array<sf::VertexArray, TILE_TEXTURE_COUNT> tileLayers;
+     std::array<const sf::Texture*, TILE_TEXTURE_COUNT> tileLayerTextures{};
+     bool tileLayerDirty = true;
+     MemoryAccount tileLayerMemory{MemoryTag::MAP}; // Vertices held by tileLayers
+     sf::Color tileTint = sf::Color::White; // Vertex color of every tile (dimmed in the editor)
+     void rebuildTileLayer();
+     void drawTiles(sf::RenderWindow& window, sf::RenderStates states);
+     void markMapChanged(); // Invalidates the tile layer and notifies observers
+     // Textures for drawing each tile type (shared handles from TextureCache)
+     TextureCache::Handle pathTexture;
+     TextureCache::Handle sceneryTexture;
+     TextureCache::Handle beginningTexture;
+     TextureCache::Handle endTexture;
      std::pair<int, int> startPos, endPos;
  
      void picker(char direction); // Select start/end positions
      void pathGenerator(); // Generate path between points
      void loadPresetLevel(); // Load predefined map
+     void generateSerpentineLevel(); // Fill the synthetic level's lanes
+     void loadTextures(); // Fetch tile textures on first draw (never in headless runs)
      bool isValidTile(int x, int y) const;
  };
  
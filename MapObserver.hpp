@@ -27,6 +27,7 @@ class MapObserver : public IObserver {
 private:
     MapGenerator* subject;
     sf::RenderWindow* window;
+    bool changed = true;  // Nothing has been rendered yet
 
 public:
     MapObserver(MapGenerator* mg, sf::RenderWindow* win)
@@ -39,13 +40,21 @@ public:
         subject->removeObserver(this);
     }
 
+    // Only records that the map changed; drawing belongs to render()
     void update() override {
-        if (window && subject)
-        {
-            // Calling the Draw method
+        changed = true;
+    }
+
+    // Render phase: draws the subject and clears the change record
+    void render() {
+        if (window && subject) {
             subject->draw(*window);
         }
+        changed = false;
     }
+
+    // True if the subject reported a change since the last render()
+    bool hasChanged() const { return changed; }
 };
 
 #endif // MAPOBSERVER_H
@@ -0,0 +1,68 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * MemoryTracker.cpp - Per-subsystem memory accounting implementation
+ *
+ * Purpose: Holds the per-tag byte totals, raises each peak as the totals
+ * grow, and names the tags.
+ *
+ * Dependencies: MemoryTracker.hpp, array, atomic
+ */
+
+/**
+ * @file MemoryTracker.cpp
+ * @brief Implements the per-subsystem memory totals
+ */
+
+#include "MemoryTracker.hpp"
+#include <array>
+#include <atomic>
+
+namespace {
+
+struct Totals {
+    std::array<std::atomic<std::size_t>, MemoryTracker::TAG_COUNT> current;
+    std::array<std::atomic<std::size_t>, MemoryTracker::TAG_COUNT> peak;
+};
+
+// Zero-initialized with no constructor to run, so containers owned by other
+// static objects can report before and after this file's initialization
+Totals totals;
+
+std::size_t indexOf(MemoryTag tag) {
+    return static_cast<std::size_t>(tag);
+}
+
+} // namespace
+
+void MemoryTracker::allocated(MemoryTag tag, std::size_t bytes) {
+    std::size_t i = indexOf(tag);
+    std::size_t now = totals.current[i].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak = totals.peak[i].load(std::memory_order_relaxed);
+    while (now > peak && !totals.peak[i].compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+    }
+}
+
+void MemoryTracker::released(MemoryTag tag, std::size_t bytes) {
+    totals.current[indexOf(tag)].fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::getCurrent(MemoryTag tag) {
+    return totals.current[indexOf(tag)].load(std::memory_order_relaxed);
+}
+
+std::size_t MemoryTracker::getPeak(MemoryTag tag) {
+    return totals.peak[indexOf(tag)].load(std::memory_order_relaxed);
+}
+
+const char* MemoryTracker::getName(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::CRITTERS: return "critters";
+        case MemoryTag::TOWERS: return "towers";
+        case MemoryTag::PROJECTILES: return "projectiles";
+        case MemoryTag::MAP: return "map";
+        case MemoryTag::TEXTURES: return "textures";
+        default: return "unknown";
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * MemoryTracker.hpp - Per-subsystem memory accounting
+ *
+ * Purpose: Keeps current and peak bytes for each subsystem's tag: critters,
+ * towers with their upgrades, projectiles, the map and textures. Containers
+ * report through TrackingAllocator, whose tag is part of the container type.
+ * Memory that no allocator of ours owns, such as SFML vertex arrays and
+ * textures, is reported through a MemoryAccount sized after each change.
+ * Totals are relaxed atomics, so any thread may report.
+ *
+ * Dependencies: cstddef, cstdint, memory, vector
+ */
+/**
+ * @file MemoryTracker.hpp
+ * @brief Implementation of Memory Tracker header file
+ */
+
+#ifndef MEMORYTRACKER_HPP
+#define MEMORYTRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+enum class MemoryTag : std::uint8_t {
+    CRITTERS,       // Critter store fields, slots and spatial index
+    TOWERS,         // Tower objects, their modifier lists and the tower manager's grids
+    PROJECTILES,    // Projectile pool, free list and draw batch
+    MAP,            // Tile grid, cached tile layers and the critter path
+    TEXTURES,       // Decoded textures, at four bytes per pixel
+    COUNT
+};
+
+class MemoryTracker {
+public:
+    static constexpr std::size_t TAG_COUNT = static_cast<std::size_t>(MemoryTag::COUNT);
+
+    static void allocated(MemoryTag tag, std::size_t bytes);
+    static void released(MemoryTag tag, std::size_t bytes);
+
+    static std::size_t getCurrent(MemoryTag tag);
+    // Highest current value since start-up
+    static std::size_t getPeak(MemoryTag tag);
+
+    static const char* getName(MemoryTag tag);
+};
+
+// Standard allocator that reports its blocks under Tag
+template <typename T, MemoryTag Tag>
+class TrackingAllocator {
+public:
+    using value_type = T;
+
+    TrackingAllocator() noexcept = default;
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U, Tag>&) noexcept {}
+
+    template <typename U>
+    struct rebind { using other = TrackingAllocator<U, Tag>; };
+
+    T* allocate(std::size_t n) {
+        T* block = std::allocator<T>().allocate(n);
+        MemoryTracker::allocated(Tag, n * sizeof(T));
+        return block;
+    }
+
+    void deallocate(T* block, std::size_t n) noexcept {
+        MemoryTracker::released(Tag, n * sizeof(T));
+        std::allocator<T>().deallocate(block, n);
+    }
+
+    template <typename U>
+    bool operator==(const TrackingAllocator<U, Tag>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const TrackingAllocator<U, Tag>&) const noexcept { return false; }
+};
+
+template <typename T, MemoryTag Tag>
+using TrackedVector = std::vector<T, TrackingAllocator<T, Tag>>;
+
+// Bytes held somewhere the allocator cannot see, such as inside an SFML
+// object. set() replaces the reported size; destruction releases it.
+class MemoryAccount {
+public:
+    explicit MemoryAccount(MemoryTag tag) : tag(tag) {}
+    // A copy holds its own copy of the memory
+    MemoryAccount(const MemoryAccount& other) : tag(other.tag) { set(other.bytes); }
+    MemoryAccount& operator=(const MemoryAccount& other) {
+        set(other.bytes);
+        return *this;
+    }
+    ~MemoryAccount() { set(0); }
+
+    void set(std::size_t newBytes) {
+        if (newBytes > bytes) {
+            MemoryTracker::allocated(tag, newBytes - bytes);
+        } else if (newBytes < bytes) {
+            MemoryTracker::released(tag, bytes - newBytes);
+        }
+        bytes = newBytes;
+    }
+    std::size_t getBytes() const { return bytes; }
+
+private:
+    MemoryTag tag;
+    std::size_t bytes = 0;
+};
+
+#endif // MEMORYTRACKER_HPP
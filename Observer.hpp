@@ -5,9 +5,12 @@
  * Observer.hpp - Observer pattern implementation
  * 
  * Purpose: Defines the core Observer pattern interfaces and base classes,
- * enabling decoupled communication between game components.
+ * enabling decoupled communication between game components. Notifications
+ * are coalesced: any number of notify() calls within a tick are delivered
+ * as a single update() when the owner calls flushNotifications().
+ * Each notify() call is counted under the subject's Counter.
  * 
- * Dependencies: Standard C++ libraries
+ * Dependencies: CounterRegistry, Standard C++ libraries
  */
 /**
  * @file Observer.hpp
@@ -19,6 +22,7 @@
 
 #include <vector>
 #include <algorithm>
+#include "CounterRegistry.hpp"
 
 /**
  * Any class that wants to "observe" changes in a subject must implement update().
@@ -35,8 +39,13 @@ public:
 class Observable {
 private:
     std::vector<IObserver*> observers;
+    bool changed = false;  // Set by notify(), cleared by flushNotifications()
+    Counter notifyCounter;
 
 public:
+    // notifyCounter counts this subject's notify() calls
+    explicit Observable(Counter notifyCounter = Counter::NOTIFY_OTHER)
+        : notifyCounter(notifyCounter) {}
     virtual ~Observable() = default;
 
     void addObserver(IObserver* obs) {
@@ -50,13 +59,24 @@ public:
         );
     }
 
-protected:
-    // Derived classes call notify() to signal changes:
-    void notify() {
+    // Delivers a single update() to every observer if anything changed since
+    // the last flush. Called once at the end of each tick.
+    void flushNotifications() {
+        if (!changed) return;
+        changed = false;
         for (auto* obs : observers) {
             obs->update();
         }
     }
+
+    bool hasPendingNotification() const { return changed; }
+
+protected:
+    // Derived classes call notify() to signal changes; delivery waits for flushNotifications()
+    void notify() {
+        changed = true;
+        CounterRegistry::add(notifyCounter);
+    }
 };
 
 #endif // OBSERVER_H
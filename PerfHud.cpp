@@ -0,0 +1,142 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * PerfHud.cpp - On-screen performance overlay implementation
+ *
+ * Purpose: Formats the profiler statistics, memory totals and counter
+ * rates into fixed buffers and sizes the overlay panel to fit them.
+ *
+ * Dependencies: SFML 3.0, PerfHud.hpp, FrameProfiler, MemoryTracker, CounterRegistry, algorithm, cstdio
+ */
+
+/**
+ * @file PerfHud.cpp
+ * @brief Implements the performance overlay
+ */
+
+#include "PerfHud.hpp"
+#include "FrameProfiler.hpp"
+#include "MemoryTracker.hpp"
+#include <algorithm>
+#include <cstdio>
+
+PerfHud::PerfHud(const sf::Font& font)
+    : text(font)
+    , counterText(font)
+{
+    for (sf::Text* column : {&text, &counterText}) {
+        column->setCharacterSize(13);
+        column->setFillColor(sf::Color::White);
+        column->setOutlineColor(sf::Color::Black);
+        column->setOutlineThickness(1.0f);
+    }
+    text.setPosition(sf::Vector2f(20.f, 80.f));
+
+    background.setFillColor(sf::Color(0, 0, 0, 170));
+    background.setOutlineColor(sf::Color(255, 255, 255, 120));
+    background.setOutlineThickness(1.0f);
+}
+
+void PerfHud::toggle() {
+    visible = !visible;
+    FrameProfiler::instance().setEnabled(visible);
+    sinceRefresh = REFRESH_INTERVAL;
+    if (visible) {
+        text.setString("Collecting frame timings...");
+        counterText.setString("");
+        lastCounters = CounterRegistry::instance().snapshot();
+        fitBackground();
+    }
+}
+
+void PerfHud::update(GameWorld& world, float deltaTime) {
+    if (!visible) return;
+
+    sinceRefresh += deltaTime;
+    if (sinceRefresh < REFRESH_INTERVAL) return;
+    sinceRefresh = 0.0f;
+
+    const FrameProfiler& profiler = FrameProfiler::instance();
+    if (profiler.getFrameCount() == 0) return;
+
+    char buffer[1536];
+    int length = std::snprintf(buffer, sizeof(buffer),
+        "Frame  %.2f ms avg  %.2f ms max  (%zu frames)\n\n",
+        profiler.getAverageFrameMs(), profiler.getMaxFrameMs(), profiler.getFrameCount());
+
+    for (std::size_t i = 0; i < FrameProfiler::PHASE_COUNT && length < static_cast<int>(sizeof(buffer)); ++i) {
+        FramePhase phase = static_cast<FramePhase>(i);
+        // Tooltips and the shop are timed inside input and ui draw
+        bool nested = phase == FramePhase::TOOLTIPS || phase == FramePhase::SHOP_DRAW;
+        length += std::snprintf(buffer + length, sizeof(buffer) - length,
+            "%s%-18s %6.3f  %6.3f ms\n", nested ? "  " : "",
+            FrameProfiler::getPhaseName(phase), profiler.getAverageMs(phase), profiler.getMaxMs(phase));
+    }
+
+    if (length < static_cast<int>(sizeof(buffer))) {
+        length += std::snprintf(buffer + length, sizeof(buffer) - length,
+            "\nDraw calls  %.0f avg  %u max\n"
+            "Critters %zu   Towers %zu   Projectiles %zu\n\n"
+            "Memory              current     peak KB",
+            profiler.getAverageDrawCalls(), static_cast<unsigned>(profiler.getMaxDrawCalls()),
+            world.getSpawner().getCritters().size(),
+            world.getTowerManager().getTowerCount(),
+            world.getProjectiles().getActiveCount());
+    }
+
+    for (std::size_t i = 0; i < MemoryTracker::TAG_COUNT && length < static_cast<int>(sizeof(buffer)); ++i) {
+        MemoryTag tag = static_cast<MemoryTag>(i);
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, "\n%-18s %8.1f %8.1f",
+            MemoryTracker::getName(tag), MemoryTracker::getCurrent(tag) / 1024.0, MemoryTracker::getPeak(tag) / 1024.0);
+    }
+
+    text.setString(buffer);
+    updateCounters();
+    fitBackground();
+}
+
+void PerfHud::updateCounters() {
+    CounterRegistry::Snapshot counters = CounterRegistry::instance().snapshot();
+    auto delta = [&](Counter counter) {
+        std::size_t i = static_cast<std::size_t>(counter);
+        return static_cast<double>(counters[i] - lastCounters[i]);
+    };
+    double ticks = delta(Counter::SIM_STEPS);
+    double finds = delta(Counter::FIND_TARGET_CALLS);
+
+    char buffer[1024];
+    int length = std::snprintf(buffer, sizeof(buffer), "Per tick (%.0f ticks)\n\n", ticks);
+    for (std::size_t i = 1; i < CounterRegistry::COUNTER_COUNT && length < static_cast<int>(sizeof(buffer)); ++i) {
+        Counter counter = static_cast<Counter>(i);
+        length += std::snprintf(buffer + length, sizeof(buffer) - length, "%-24s %9.1f\n",
+            CounterRegistry::getName(counter), ticks > 0 ? delta(counter) / ticks : 0.0);
+    }
+    if (length < static_cast<int>(sizeof(buffer))) {
+        std::snprintf(buffer + length, sizeof(buffer) - length, "\nscanned per find_target  %9.1f",
+            finds > 0 ? delta(Counter::CRITTERS_SCANNED) / finds : 0.0);
+    }
+
+    counterText.setString(buffer);
+    lastCounters = counters;
+}
+
+void PerfHud::fitBackground() {
+    sf::FloatRect timings = text.getGlobalBounds();
+    counterText.setPosition(sf::Vector2f(timings.position.x + timings.size.x + 24.f, text.getPosition().y));
+    sf::FloatRect counters = counterText.getGlobalBounds();
+
+    float right = std::max(timings.position.x + timings.size.x, counters.position.x + counters.size.x);
+    float bottom = std::max(timings.position.y + timings.size.y, counters.position.y + counters.size.y);
+    background.setPosition(sf::Vector2f(timings.position.x - 8.f, timings.position.y - 8.f));
+    background.setSize(sf::Vector2f(right - timings.position.x + 16.f, bottom - timings.position.y + 16.f));
+}
+
+void PerfHud::draw(sf::RenderWindow& window) const {
+    if (!visible) return;
+
+    window.draw(background);
+    window.draw(text);
+    window.draw(counterText);
+    FrameProfiler::instance().countDrawCalls(3);
+}
@@ -0,0 +1,52 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * PerfHud.hpp - On-screen performance overlay
+ *
+ * Purpose: Shows the frame profiler's rolling averages and maxima per frame
+ * phase, with draw calls, entity counts and memory per subsystem, in a
+ * panel in the top left corner. A second column shows the hot path
+ * counters per simulation tick. The text is rebuilt a few times per
+ * second, and only while the overlay is visible.
+ *
+ * Dependencies: SFML 3.0, FrameProfiler, CounterRegistry, GameWorld
+ */
+/**
+ * @file PerfHud.hpp
+ * @brief Implementation of Perf Hud header file
+ */
+
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "GameWorld.hpp"
+#include "CounterRegistry.hpp"
+
+class PerfHud {
+public:
+    explicit PerfHud(const sf::Font& font);
+
+    // Shows or hides the overlay; profiling runs only while it is shown
+    void toggle();
+    bool isVisible() const { return visible; }
+
+    // Refreshes the text from the profiler, the counters and the world's entity counts
+    void update(GameWorld& world, float deltaTime);
+    void draw(sf::RenderWindow& window) const;
+
+private:
+    // Rebuilds the counter column from the change since the last refresh
+    void updateCounters();
+    // Places the counter column and sizes the panel behind both columns
+    void fitBackground();
+
+    static constexpr float REFRESH_INTERVAL = 0.5f;  // Seconds between text updates
+
+    bool visible = false;
+    float sinceRefresh = REFRESH_INTERVAL;
+    sf::Text text;
+    sf::Text counterText;
+    sf::RectangleShape background;
+    // Counter totals at the last refresh
+    CounterRegistry::Snapshot lastCounters{};
+};
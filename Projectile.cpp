@@ -7,7 +7,7 @@
  * Purpose: Implements projectile movement, collision detection,
  * and damage application logic.
  * 
- * Dependencies: SFML 3.0, Projectile.hpp, cmath
+ * Dependencies: SFML 3.0, Projectile.hpp, CounterRegistry, cmath
  */
 
  /**
@@ -16,17 +16,22 @@
  */
 
 #include "Projectile.hpp"
+#include "CounterRegistry.hpp"
+#include <array>
 #include <cmath>
 
 void Projectile::update(float deltaTime) {
+    previousPosition = position;
+
     // Don't update if we've already hit or lost our target
-    if (!target || hitTarget || target->isDead()) {
+    int targetIndex = critters->resolve(target);
+    if (hitTarget || targetIndex < 0 || critters->isDead(targetIndex)) {
         hitTarget = true;
         return;
     }
 
     // Get current critter position
-    sf::Vector2f targetPos = target->getSprite().getPosition();
+    sf::Vector2f targetPos = critters->getPosition(targetIndex);
     
     // Calculate direction
     sf::Vector2f direction = targetPos - position;
@@ -39,86 +44,90 @@ void Projectile::update(float deltaTime) {
 
         // Check if hit target - using slightly larger threshold to prevent rebounding
         if (distance < 15.0f) {
-            dealDamage();
+            dealDamage(targetIndex);
             hitTarget = true;
         }
     }
 }
 
-void Projectile::dealDamage() {
-    // Safety check - make sure target exists and is alive
-    if (!target || target->isDead()) return;
-
+void Projectile::dealDamage(std::size_t targetIndex) {
     // Deal damage based on tower type
-    if (isSpecialTower && target->getTexturePath() == "textures/critter3.png") {
-        // Special towers deal 1200% more damage to level 3 monsters
-        target->takeDamage(damage * 12.0f, true);  // Pass true for special damage
+    const CritterTypeInfo& type = CritterTypeRegistry::instance().get(critters->getTypeId(targetIndex));
+    if (isSpecialTower && type.specialMultiplier != 1.0f) {
+        // Special towers deal bonus damage to the types that carry a multiplier (level 3)
+        critters->takeDamage(targetIndex, damage * type.specialMultiplier, true);  // Pass true for special damage
     } else {
         // Normal damage for all other cases
-        target->takeDamage(damage, false);  // Pass false for normal damage
+        critters->takeDamage(targetIndex, damage, false);  // Pass false for normal damage
     }
 
     // Handle AoE damage if applicable
-    if (aoeRadius > 0.0f && allCritters) {
-        sf::Vector2f impactPos = target->getSprite().getPosition();
+    if (aoeRadius > 0.0f) {
+        sf::Vector2f impactPos = critters->getPosition(targetIndex);
         
-        // Check all critters for AoE damage
-        for (auto& critter : *allCritters) {
+        // Splash every other live critter within the AoE radius
+        std::uint64_t splashHits = 0;
+        critters->queryRadius(impactPos, aoeRadius, [&](std::size_t i) {
             // Skip invalid targets
-            if (!critter || critter.get() == target || critter->isDead()) {
-                continue;
+            if (i == targetIndex || critters->isDead(i)) {
+                return;
             }
 
-            // Calculate distance to this critter
-            sf::Vector2f otherPos = critter->getSprite().getPosition();
-            float dist = std::sqrt(
-                std::pow(impactPos.x - otherPos.x, 2) + 
-                std::pow(impactPos.y - otherPos.y, 2)
-            );
+            critters->takeDamage(i, damage * 0.5f, false); // 50% splash damage, non-special
+            ++splashHits;
+        });
+        CounterRegistry::add(Counter::SPLASH_HITS, splashHits);
+    }
+}
 
-            // If within AoE radius, deal splash damage
-            if (dist <= aoeRadius) {
-                critter->takeDamage(damage * 0.5f, false); // 50% splash damage, non-special
-            }
+void Projectile::writeVertices(sf::Vertex* vertices, float alpha) const {
+    // Unit circle points, shared by every projectile
+    static const std::array<sf::Vector2f, CIRCLE_SEGMENTS + 1> circle = [] {
+        std::array<sf::Vector2f, CIRCLE_SEGMENTS + 1> points{};
+        for (int i = 0; i <= CIRCLE_SEGMENTS; ++i) {
+            float angle = 2.0f * 3.14159265f * i / CIRCLE_SEGMENTS;
+            points[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
         }
+        return points;
+    }();
+
+    // Different colors based on tower type
+    sf::Color color = isSpecialTower ? sf::Color::Magenta   // Purple/pink color for special tower
+                                     : sf::Color::Yellow;   // Default yellow for other towers
+    sf::Vector2f center = getDrawPosition(alpha);
+
+    // One triangle per segment, fanning out from the center
+    for (int i = 0; i < CIRCLE_SEGMENTS; ++i) {
+        sf::Vertex* triangle = vertices + i * 3;
+        triangle[0].position = center;
+        triangle[1].position = center + circle[i] * RADIUS;
+        triangle[2].position = center + circle[i + 1] * RADIUS;
+        triangle[0].color = triangle[1].color = triangle[2].color = color;
     }
 }
 
-void Projectile::draw(sf::RenderWindow& window) const {
-    if (hitTarget) return;
+bool Projectile::drawAoeIndicator(sf::RenderWindow& window, float alpha) const {
+    if (hitTarget || aoeRadius <= 0.0f) return false;
 
-    // Draw the projectile with different colors based on tower type
-    sf::CircleShape projectileShape(5.0f);
-    if (isSpecialTower) {
-        projectileShape.setFillColor(sf::Color::Magenta);  // Purple/pink color for special tower
-    } else {
-        projectileShape.setFillColor(sf::Color::Yellow);   // Default yellow for other towers
-    }
-    
-    // Set origin to center of the circle
-    projectileShape.setOrigin(sf::Vector2f(5.0f, 5.0f));
-    
-    // Set position directly 
-    projectileShape.setPosition(position);
-    
-    window.draw(projectileShape);
+    int targetIndex = critters->resolve(target);
+    if (targetIndex < 0) return false;
 
-    // Draw AoE radius indicator for area effect towers
-    if (aoeRadius > 0.0f && target) {
-        sf::Vector2f targetPos = target->getSprite().getPosition();
-        float dist = std::sqrt(
-            std::pow(position.x - targetPos.x, 2) + 
-            std::pow(position.y - targetPos.y, 2)
-        );
-        
-        // Only show AoE indicator when projectile is close to target
-        if (dist < 50.0f) {
-            sf::CircleShape aoeIndicator(aoeRadius);
-            aoeIndicator.setPosition(sf::Vector2f(targetPos.x - aoeRadius, targetPos.y - aoeRadius));
-            aoeIndicator.setFillColor(sf::Color(255, 255, 0, 64));  // Semi-transparent yellow
-            aoeIndicator.setOutlineColor(sf::Color(255, 255, 0, 128));
-            aoeIndicator.setOutlineThickness(1.0f);
-            window.draw(aoeIndicator);
-        }
+    sf::Vector2f drawPosition = getDrawPosition(alpha);
+    sf::Vector2f targetPos = critters->getInterpolatedPosition(targetIndex, alpha);
+    float dist = std::sqrt(
+        std::pow(drawPosition.x - targetPos.x, 2) + 
+        std::pow(drawPosition.y - targetPos.y, 2)
+    );
+    
+    // Only show AoE indicator when projectile is close to target
+    if (dist < 50.0f) {
+        sf::CircleShape aoeIndicator(aoeRadius);
+        aoeIndicator.setPosition(sf::Vector2f(targetPos.x - aoeRadius, targetPos.y - aoeRadius));
+        aoeIndicator.setFillColor(sf::Color(255, 255, 0, 64));  // Semi-transparent yellow
+        aoeIndicator.setOutlineColor(sf::Color(255, 255, 0, 128));
+        aoeIndicator.setOutlineThickness(1.0f);
+        window.draw(aoeIndicator);
+        return true;
     }
-}
\ No newline at end of file
+    return false;
+}
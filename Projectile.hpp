@@ -5,9 +5,10 @@
  * Projectile.hpp - Tower projectile system
  * 
  * Purpose: Manages tower projectiles including movement, collision
- * detection, and damage application to enemies.
+ * detection, and damage application to enemies. Projectiles are stored by
+ * value in the ProjectileSystem pool.
  * 
- * Dependencies: SFML 3.0, Critter
+ * Dependencies: SFML 3.0, CritterStore
  */
 /**
  * @file Projectile.hpp
@@ -16,40 +17,55 @@
 
 #pragma once
 #include <SFML/Graphics.hpp>
-#include "Critter.hpp"
+#include "CritterStore.hpp"
 #include <vector>
 
 class Projectile {
 public:
+    // Projectiles are drawn as circles built from this many triangles
+    static constexpr int CIRCLE_SEGMENTS = 8;
+    static constexpr std::size_t VERTEX_COUNT = CIRCLE_SEGMENTS * 3;
+    static constexpr float RADIUS = 5.0f;
+
     Projectile(const sf::Vector2f& origin, 
-               Critter* target, 
+               CritterStore& critters, // Store holding the target, also used for AoE damage
+               CritterHandle target, // Resolved every update; a stale handle ends the flight
                float damage, 
                float aoeRadius = 0.0f, // Splash damage radius
-               std::vector<std::unique_ptr<Critter>>* allCritters = nullptr,
                bool isSpecial = false) // Special tower projectile
         : position(origin)
+        , previousPosition(origin)
+        , critters(&critters)
         , target(target)
         , speed(200.0f)
         , damage(damage)
         , aoeRadius(aoeRadius)
-        , allCritters(allCritters)
         , hitTarget(false)
         , isSpecialTower(isSpecial)
     {}
     
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window) const;
+    // Writes VERTEX_COUNT triangle vertices for the projectile body at the
+    // position blended between the last two updates (alpha 0..1)
+    void writeVertices(sf::Vertex* vertices, float alpha) const;
+    // Draws the splash radius for area effect projectiles close to their
+    // target; returns true if anything was drawn
+    bool drawAoeIndicator(sf::RenderWindow& window, float alpha) const;
     bool isActive() const { return !hitTarget; }
 
 private:
-    void dealDamage();
+    void dealDamage(std::size_t targetIndex);
+    sf::Vector2f getDrawPosition(float alpha) const {
+        return previousPosition + (position - previousPosition) * alpha;
+    }
 
     sf::Vector2f position;
-    Critter* target;
+    sf::Vector2f previousPosition;
+    CritterStore* critters;
+    CritterHandle target;
     float speed;
     float damage;
     float aoeRadius;
-    std::vector<std::unique_ptr<Critter>>* allCritters;
     bool hitTarget;
     bool isSpecialTower;
 };
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * ProjectileSystem.cpp - World-level projectile pool implementation
+ * 
+ * Purpose: Implements slot reuse, the single update pass and the batched
+ * projectile draw.
+ * 
+ * Dependencies: ProjectileSystem.hpp, FrameProfiler, CounterRegistry, algorithm
+ */
+
+/**
+ * @file ProjectileSystem.cpp
+ * @brief Implementation of the Projectile System
+ */
+
+#include "ProjectileSystem.hpp"
+#include "FrameProfiler.hpp"
+#include "CounterRegistry.hpp"
+#include <algorithm>
+
+ProjectileSystem::ProjectileSystem(std::size_t capacity)
+    : capacity(capacity)
+    , batch(sf::PrimitiveType::Triangles)
+{
+    pool.reserve(capacity);
+    freeSlots.reserve(capacity);
+}
+
+bool ProjectileSystem::spawn(const sf::Vector2f& origin,
+                             CritterStore& critters,
+                             CritterHandle target,
+                             float damage,
+                             float aoeRadius,
+                             bool isSpecial)
+{
+    // Growing the pool would allocate mid-step, so a full pool refuses the shot
+    if (freeSlots.empty() && pool.size() == capacity) {
+        CounterRegistry::add(Counter::PROJECTILES_REFUSED);
+        return false;
+    }
+
+    Projectile projectile(origin, critters, target, damage, aoeRadius, isSpecial);
+
+    if (!freeSlots.empty()) {
+        pool[freeSlots.back()] = projectile;
+        freeSlots.pop_back();
+    } else {
+        pool.push_back(projectile);
+    }
+    ++activeCount;
+    CounterRegistry::add(Counter::PROJECTILES_SPAWNED);
+    return true;
+}
+
+void ProjectileSystem::update(float deltaTime) {
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        Projectile& projectile = pool[i];
+        if (!projectile.isActive()) continue;
+
+        projectile.update(deltaTime);
+
+        // Hit or lost its target: the slot can be reused
+        if (!projectile.isActive()) {
+            freeSlots.push_back(static_cast<std::uint32_t>(i));
+            --activeCount;
+            CounterRegistry::add(Counter::PROJECTILES_EXPIRED);
+        }
+    }
+}
+
+void ProjectileSystem::draw(sf::RenderWindow& window, float alpha) const {
+    if (activeCount == 0) return;
+
+    batch.resize(activeCount * Projectile::VERTEX_COUNT);
+    batchMemory.set(std::max(batchMemory.getBytes(), batch.getVertexCount() * sizeof(sf::Vertex)));
+    std::size_t vertex = 0;
+    for (const Projectile& projectile : pool) {
+        if (!projectile.isActive()) continue;
+        projectile.writeVertices(&batch[vertex], alpha);
+        vertex += Projectile::VERTEX_COUNT;
+    }
+    window.draw(batch);
+    std::uint32_t drawCalls = 1;
+
+    // Area effect indicators are few, so they are drawn individually
+    for (const Projectile& projectile : pool) {
+        if (projectile.isActive() && projectile.drawAoeIndicator(window, alpha)) {
+            drawCalls++;
+        }
+    }
+    FrameProfiler::instance().countDrawCalls(drawCalls);
+}
+
+void ProjectileSystem::clear() {
+    pool.clear();
+    freeSlots.clear();
+    activeCount = 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * ProjectileSystem.hpp - World-level projectile pool
+ * 
+ * Purpose: Owns every projectile in flight in one contiguous pool. Towers
+ * only request new projectiles; the system updates them all in one pass,
+ * reuses finished slots through a free list and draws them in one batch.
+ * The pool is reserved once at a fixed capacity and never grows.
+ * Projectiles live on after the tower that fired them is sold.
+ * 
+ * Dependencies: SFML 3.0, Projectile, CritterStore, MemoryTracker, vector, cstdint
+ */
+/**
+ * @file ProjectileSystem.hpp
+ * @brief Implementation of Projectile System header file
+ */
+
+#ifndef PROJECTILESYSTEM_HPP
+#define PROJECTILESYSTEM_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "Projectile.hpp"
+#include "CritterStore.hpp"
+#include "MemoryTracker.hpp"
+
+class ProjectileSystem {
+public:
+    // Slots reserved up front. 200 level 3 towers peak at about 1,100
+    // projectiles in flight, so this leaves several times that headroom.
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+    explicit ProjectileSystem(std::size_t capacity = DEFAULT_CAPACITY);
+
+    // Fires a projectile from origin at the critter referred to by target.
+    // Returns false, firing nothing, when every slot is in flight.
+    bool spawn(const sf::Vector2f& origin,
+               CritterStore& critters,
+               CritterHandle target,
+               float damage,
+               float aoeRadius = 0.0f,
+               bool isSpecial = false);
+
+    // Moves every projectile and returns finished ones to the free list
+    void update(float deltaTime);
+
+    // Draws all projectiles in one batch, blended between the last two updates
+    void draw(sf::RenderWindow& window, float alpha = 1.0f) const;
+
+    // Removes every projectile but keeps the pool's memory
+    void clear();
+
+    std::size_t getActiveCount() const { return activeCount; }
+    std::size_t getPoolSize() const { return pool.size(); }
+    std::size_t getCapacity() const { return capacity; }
+
+private:
+    // Contiguous projectile slots; inactive slots are listed in freeSlots
+    TrackedVector<Projectile, MemoryTag::PROJECTILES> pool;
+    TrackedVector<std::uint32_t, MemoryTag::PROJECTILES> freeSlots;
+    std::size_t capacity;
+    std::size_t activeCount = 0;
+
+    // Triangles for every active projectile, refilled on each draw
+    mutable sf::VertexArray batch;
+    // The batch's vertex storage never shrinks, so this tracks its largest size
+    mutable MemoryAccount batchMemory{MemoryTag::PROJECTILES};
+};
+
+#endif // PROJECTILESYSTEM_HPP
@@ -0,0 +1,210 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * RangeKernel.cpp - Vectorized range filter implementation
+ *
+ * Purpose: Implements the scalar, SSE2 and AVX2 range filters and picks
+ * one at startup. Each version computes dx*dx + dy*dy and compares it with
+ * the squared radius in the same order, so they select exactly the same
+ * points. The vector versions compact each block of results with a lookup
+ * table, so the cost does not depend on how many points are in range.
+ *
+ * Dependencies: RangeKernel.hpp, CounterRegistry, immintrin.h (x86 only)
+ */
+
+/**
+ * @file RangeKernel.cpp
+ * @brief Implementation of the Range Kernel
+ */
+
+#include "RangeKernel.hpp"
+#include "CounterRegistry.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TD_RANGE_KERNEL_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using KernelFn = std::size_t (*)(const float*, const float*, std::size_t,
+                                 float, float, float, std::uint32_t, std::uint32_t*);
+
+std::size_t filterScalar(const float* xs, const float* ys, std::size_t count,
+                         float cx, float cy, float radiusSquared,
+                         std::uint32_t firstIndex, std::uint32_t* out)
+{
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        // Always store, only advance when in range
+        out[written] = firstIndex + static_cast<std::uint32_t>(i);
+        written += (dx * dx + dy * dy <= radiusSquared) ? 1 : 0;
+    }
+    return written;
+}
+
+#ifdef TD_RANGE_KERNEL_X86
+
+// For every comparison mask, the indices of its set lanes packed to the front
+// and how many there are. Lets the vector kernels compact a block of results
+// with one table load and one store, whatever the mask.
+struct LaneTables {
+    std::uint32_t lanes4[16][4];
+    std::uint8_t lanes8[256][8];
+    std::uint8_t count[256];
+};
+
+constexpr LaneTables makeLaneTables() {
+    LaneTables tables{};
+    for (unsigned mask = 0; mask < 256; ++mask) {
+        unsigned n = 0;
+        for (unsigned lane = 0; lane < 8; ++lane) {
+            if ((mask >> lane) & 1u) {
+                tables.lanes8[mask][n] = static_cast<std::uint8_t>(lane);
+                if (mask < 16) tables.lanes4[mask][n] = lane;
+                ++n;
+            }
+        }
+        tables.count[mask] = static_cast<std::uint8_t>(n);
+    }
+    return tables;
+}
+
+alignas(16) constexpr LaneTables LANE_TABLES = makeLaneTables();
+
+// The compacting stores write a whole block at out + written. That stays
+// inside out because written never exceeds the index of the current block.
+
+std::size_t filterSse2(const float* xs, const float* ys, std::size_t count,
+                       float cx, float cy, float radiusSquared,
+                       std::uint32_t firstIndex, std::uint32_t* out)
+{
+    const __m128 centerX = _mm_set1_ps(cx);
+    const __m128 centerY = _mm_set1_ps(cy);
+    const __m128 limit = _mm_set1_ps(radiusSquared);
+
+    std::size_t written = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), centerX);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), centerY);
+        __m128 distanceSquared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(distanceSquared, limit)));
+
+        __m128i lanes = _mm_load_si128(reinterpret_cast<const __m128i*>(LANE_TABLES.lanes4[mask]));
+        __m128i base = _mm_set1_epi32(static_cast<int>(firstIndex + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), _mm_add_epi32(lanes, base));
+        written += LANE_TABLES.count[mask];
+    }
+    return written + filterScalar(xs + i, ys + i, count - i, cx, cy, radiusSquared,
+                                  firstIndex + static_cast<std::uint32_t>(i), out + written);
+}
+
+__attribute__((target("avx2")))
+std::size_t filterAvx2(const float* xs, const float* ys, std::size_t count,
+                       float cx, float cy, float radiusSquared,
+                       std::uint32_t firstIndex, std::uint32_t* out)
+{
+    const __m256 centerX = _mm256_set1_ps(cx);
+    const __m256 centerY = _mm256_set1_ps(cy);
+    const __m256 limit = _mm256_set1_ps(radiusSquared);
+
+    std::size_t written = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), centerX);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), centerY);
+        __m256 distanceSquared = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        unsigned mask = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_cmp_ps(distanceSquared, limit, _CMP_LE_OQ)));
+
+        __m256i lanes = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(LANE_TABLES.lanes8[mask])));
+        __m256i base = _mm256_set1_epi32(static_cast<int>(firstIndex + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written), _mm256_add_epi32(lanes, base));
+        written += LANE_TABLES.count[mask];
+    }
+    // Clear the upper register halves before running legacy SSE code, which
+    // would otherwise pay a state transition penalty on every call
+    _mm256_zeroupper();
+    // Finish the tail with the SSE2 kernel (and its scalar tail)
+    return written + filterSse2(xs + i, ys + i, count - i, cx, cy, radiusSquared,
+                                firstIndex + static_cast<std::uint32_t>(i), out + written);
+}
+
+#endif // TD_RANGE_KERNEL_X86
+
+KernelFn kernelFor(RangeKernelIsa isa) {
+    switch (isa) {
+#ifdef TD_RANGE_KERNEL_X86
+        case RangeKernelIsa::AVX2: return filterAvx2;
+        case RangeKernelIsa::SSE2: return filterSse2;
+#endif
+        default: return filterScalar;
+    }
+}
+
+RangeKernelIsa bestSupportedIsa() {
+    if (isRangeKernelSupported(RangeKernelIsa::AVX2)) return RangeKernelIsa::AVX2;
+    if (isRangeKernelSupported(RangeKernelIsa::SSE2)) return RangeKernelIsa::SSE2;
+    return RangeKernelIsa::SCALAR;
+}
+
+// Kernel in use, chosen on first use
+struct ActiveKernel {
+    RangeKernelIsa isa;
+    KernelFn fn;
+};
+
+ActiveKernel& activeKernel() {
+    static ActiveKernel active{bestSupportedIsa(), kernelFor(bestSupportedIsa())};
+    return active;
+}
+
+} // namespace
+
+std::size_t filterInRange(const float* xs, const float* ys, std::size_t count,
+                          float cx, float cy, float radiusSquared,
+                          std::uint32_t firstIndex, std::uint32_t* out)
+{
+    CounterRegistry::add(Counter::DISTANCE_CHECKS, count);
+    return activeKernel().fn(xs, ys, count, cx, cy, radiusSquared, firstIndex, out);
+}
+
+RangeKernelIsa getRangeKernelIsa() {
+    return activeKernel().isa;
+}
+
+const char* getRangeKernelName(RangeKernelIsa isa) {
+    switch (isa) {
+        case RangeKernelIsa::AVX2: return "avx2";
+        case RangeKernelIsa::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+bool isRangeKernelSupported(RangeKernelIsa isa) {
+    switch (isa) {
+        case RangeKernelIsa::SCALAR:
+            return true;
+#ifdef TD_RANGE_KERNEL_X86
+        case RangeKernelIsa::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case RangeKernelIsa::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+bool setRangeKernelIsa(RangeKernelIsa isa) {
+    if (!isRangeKernelSupported(isa)) {
+        return false;
+    }
+    activeKernel() = ActiveKernel{isa, kernelFor(isa)};
+    return true;
+}
@@ -0,0 +1,68 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * RangeKernel.hpp - Vectorized range filter
+ *
+ * Purpose: Finds the points within a radius of a center over contiguous
+ * x and y arrays, comparing squared distances several points at a time.
+ * AVX2, SSE2 and scalar versions give identical results; the fastest one
+ * the CPU supports is picked at runtime. Every range query in the game
+ * (targeting, strategy selection, splash damage, inspection) goes through it.
+ *
+ * Dependencies: cstddef, cstdint, algorithm
+ */
+/**
+ * @file RangeKernel.hpp
+ * @brief Implementation of Range Kernel header file
+ */
+
+#ifndef RANGEKERNEL_HPP
+#define RANGEKERNEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+enum class RangeKernelIsa {
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+// Writes firstIndex + i to out, in ascending order, for every i in [0, count)
+// with (xs[i] - cx)^2 + (ys[i] - cy)^2 <= radiusSquared. out must have room
+// for count indices. Returns the number of indices written.
+std::size_t filterInRange(const float* xs, const float* ys, std::size_t count,
+                          float cx, float cy, float radiusSquared,
+                          std::uint32_t firstIndex, std::uint32_t* out);
+
+// Kernel currently used by filterInRange
+RangeKernelIsa getRangeKernelIsa();
+const char* getRangeKernelName(RangeKernelIsa isa);
+bool isRangeKernelSupported(RangeKernelIsa isa);
+// Forces a kernel, e.g. to benchmark them against each other. Returns false
+// (and changes nothing) if the CPU does not support it.
+bool setRangeKernelIsa(RangeKernelIsa isa);
+
+// Points filtered per kernel call; bounds the stack buffer of forEachInRange
+constexpr std::size_t RANGE_KERNEL_CHUNK = 256;
+
+// Calls callback(firstIndex + i) for every point in range, in ascending order
+template <typename Callback>
+void forEachInRange(const float* xs, const float* ys, std::size_t count,
+                    float cx, float cy, float radiusSquared,
+                    std::uint32_t firstIndex, Callback&& callback)
+{
+    std::uint32_t hits[RANGE_KERNEL_CHUNK];
+    for (std::size_t start = 0; start < count; start += RANGE_KERNEL_CHUNK) {
+        std::size_t chunk = std::min(RANGE_KERNEL_CHUNK, count - start);
+        std::size_t found = filterInRange(xs + start, ys + start, chunk, cx, cy, radiusSquared,
+                                          firstIndex + static_cast<std::uint32_t>(start), hits);
+        for (std::size_t k = 0; k < found; ++k) {
+            callback(hits[k]);
+        }
+    }
+}
+
+#endif // RANGEKERNEL_HPP
@@ -0,0 +1,97 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * SpatialHash.cpp - Uniform grid implementation
+ * 
+ * Purpose: Implements the counting-sort rebuild of the point grid.
+ * 
+ * Dependencies: SpatialHash.hpp
+ */
+
+/**
+ * @file SpatialHash.cpp
+ * @brief Implementation of the Spatial Hash
+ */
+
+#include "SpatialHash.hpp"
+
+SpatialHash::SpatialHash(float cellSize)
+    : cellSize(cellSize)
+    , inverseCellSize(1.0f / cellSize)
+{
+}
+
+void SpatialHash::rebuild(const float* xs, const float* ys, std::size_t count) {
+    entries.clear();
+    if (count == 0) {
+        clear();
+        return;
+    }
+
+    // Size the grid to the bounding box of the points
+    int minCol = cellCoord(xs[0]), maxCol = minCol;
+    int minRow = cellCoord(ys[0]), maxRow = minRow;
+    for (std::size_t i = 1; i < count; ++i) {
+        int col = cellCoord(xs[i]);
+        int row = cellCoord(ys[i]);
+        minCol = std::min(minCol, col);
+        maxCol = std::max(maxCol, col);
+        minRow = std::min(minRow, row);
+        maxRow = std::max(maxRow, row);
+    }
+    originCol = minCol;
+    originRow = minRow;
+    cols = maxCol - minCol + 1;
+    rows = maxRow - minRow + 1;
+
+    // Count points per cell
+    const std::size_t cellCount = static_cast<std::size_t>(cols) * rows;
+    cellStart.assign(cellCount + 1, 0);
+    pointCell.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t col = cellCoord(xs[i]) - originCol;
+        std::size_t row = cellCoord(ys[i]) - originRow;
+        pointCell[i] = static_cast<std::uint32_t>(row * cols + col);
+        ++cellStart[pointCell[i] + 1];
+    }
+
+    // Prefix sum turns counts into start offsets
+    for (std::size_t c = 0; c < cellCount; ++c) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    // Scatter point indices and coordinates into their cells, using a running cursor per cell
+    entries.resize(count);
+    sortedX.resize(count);
+    sortedY.resize(count);
+    cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t k = cellCursor[pointCell[i]]++;
+        entries[k] = static_cast<std::uint32_t>(i);
+        sortedX[k] = xs[i];
+        sortedY[k] = ys[i];
+    }
+}
+
+void SpatialHash::clear() {
+    entries.clear();
+    cellStart.clear();
+    cols = 0;
+    rows = 0;
+}
+
+void SpatialHash::reserve(std::size_t count) {
+    entries.reserve(count);
+    sortedX.reserve(count);
+    sortedY.reserve(count);
+    pointCell.reserve(count);
+}
+
+void SpatialHash::reserveArea(const sf::Vector2f& min, const sf::Vector2f& max) {
+    const std::size_t cellCount =
+        static_cast<std::size_t>(cellCoord(max.x) - cellCoord(min.x) + 1) *
+        static_cast<std::size_t>(cellCoord(max.y) - cellCoord(min.y) + 1);
+    cellStart.reserve(cellCount + 1);
+    cellCursor.reserve(cellCount);
+}
@@ -0,0 +1,100 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * SpatialHash.hpp - Uniform grid for point range queries
+ * 
+ * Purpose: Buckets a set of points into square cells so that range queries
+ * only visit the cells overlapping the query circle instead of every point.
+ * The grid is rebuilt from scratch with a counting sort, so each cell's
+ * entries are stored contiguously, along with a cell-ordered copy of their
+ * coordinates that the range kernel filters without any gathering.
+ * 
+ * Dependencies: SFML 3.0 (System), MemoryTracker, RangeKernel, vector, cstdint
+ */
+/**
+ * @file SpatialHash.hpp
+ * @brief Implementation of Spatial Hash header file
+ */
+
+#ifndef SPATIALHASH_HPP
+#define SPATIALHASH_HPP
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "MemoryTracker.hpp"
+#include "RangeKernel.hpp"
+
+class SpatialHash {
+public:
+    explicit SpatialHash(float cellSize);
+
+    // Rebuilds the grid from count points given as separate x and y arrays
+    void rebuild(const float* xs, const float* ys, std::size_t count);
+    void clear();
+
+    // Capacity for count points, so rebuilds with at most that many never allocate
+    void reserve(std::size_t count);
+    // Capacity for a grid over the rectangle from min to max
+    void reserveArea(const sf::Vector2f& min, const sf::Vector2f& max);
+
+    float getCellSize() const { return cellSize; }
+
+    // Calls callback(index) for every point within radius of center, using
+    // the coordinates from the last rebuild. Cells in one grid row are
+    // adjacent in memory, so each row of the query is one kernel call.
+    template <typename Callback>
+    void forEachInRadius(const sf::Vector2f& center, float radius, Callback&& callback) const {
+        if (entries.empty()) return;
+
+        int minCol = std::max(cellCoord(center.x - radius) - originCol, 0);
+        int maxCol = std::min(cellCoord(center.x + radius) - originCol, cols - 1);
+        int minRow = std::max(cellCoord(center.y - radius) - originRow, 0);
+        int maxRow = std::min(cellCoord(center.y + radius) - originRow, rows - 1);
+        if (minCol > maxCol) return;
+
+        const float radiusSquared = radius * radius;
+        for (int row = minRow; row <= maxRow; ++row) {
+            const std::size_t rowBase = static_cast<std::size_t>(row) * cols;
+            const std::uint32_t first = cellStart[rowBase + minCol];
+            const std::uint32_t last = cellStart[rowBase + maxCol + 1];
+            forEachInRange(sortedX.data() + first, sortedY.data() + first, last - first,
+                           center.x, center.y, radiusSquared, first,
+                           [&](std::uint32_t k) { callback(static_cast<std::size_t>(entries[k])); });
+        }
+    }
+
+private:
+    int cellCoord(float value) const {
+        return static_cast<int>(std::floor(value * inverseCellSize));
+    }
+
+    float cellSize;
+    float inverseCellSize;
+
+    // Grid covers the bounding box of the points from the last rebuild
+    int originCol = 0;
+    int originRow = 0;
+    int cols = 0;
+    int rows = 0;
+
+    // The grid only indexes critters, so it reports under their tag
+    template <typename T>
+    using Array = TrackedVector<T, MemoryTag::CRITTERS>;
+
+    // Entries of cell c are entries[cellStart[c] .. cellStart[c + 1])
+    Array<std::uint32_t> cellStart;
+    Array<std::uint32_t> entries;
+    // Coordinates of entries[k], in the same order
+    Array<float> sortedX;
+    Array<float> sortedY;
+    // Rebuild scratch, kept between rebuilds to reuse its capacity
+    Array<std::uint32_t> pointCell;
+    Array<std::uint32_t> cellCursor;
+};
+
+#endif // SPATIALHASH_HPP
@@ -6,8 +6,11 @@
  * 
  * Purpose: Defines the Strategy pattern for tower targeting,
  * with an adaptive strategy that prioritizes targets based on multiple factors.
+ * Each strategy is a stateless scoring functor compiled into one fused
+ * scan over the critters in range; the strategy classes are shared
+ * singletons that wrap those scans.
  * 
- * Dependencies: Critter.hpp, vector, memory
+ * Dependencies: CritterStore.hpp, CounterRegistry, cmath, limits
  */
 /**
  * @file TargetingStrategy.hpp
@@ -18,10 +21,10 @@
  #ifndef TARGETING_STRATEGY_HPP
  #define TARGETING_STRATEGY_HPP
  
- #include "Critter.hpp"
- #include <vector>
- #include <memory>
- #include <stdexcept>
+ #include "CritterStore.hpp"
+ #include "CounterRegistry.hpp"
+ #include <cmath>
+ #include <limits>
  
  /**
   * Strategy type enum to easily identify different strategies
@@ -34,6 +37,121 @@
      CLOSEST          // Target closest to tower
  };
  
+ // Counter that tallies how often a strategy is chosen
+ inline Counter strategyCounter(StrategyType type) {
+     switch (type) {
+         case StrategyType::EXIT_PROXIMITY: return Counter::STRATEGY_EXIT_PROXIMITY;
+         case StrategyType::STRONGEST: return Counter::STRATEGY_STRONGEST;
+         case StrategyType::WEAKEST: return Counter::STRATEGY_WEAKEST;
+         case StrategyType::CLOSEST: return Counter::STRATEGY_CLOSEST;
+         case StrategyType::SMART:
+         default: return Counter::STRATEGY_SMART;
+     }
+ }
+ 
+ /**
+  * Scoring policies. Each returns a score for a live critter in range; the
+  * critter with the highest score is the target. A score of REJECT means the
+  * critter is never picked.
+  */
+ constexpr float REJECT_TARGET = -std::numeric_limits<float>::infinity();
+ 
+ // Furthest along the path is the closest to the exit
+ struct ExitProximityScore {
+     float operator()(const sf::Vector2f&, const CritterStore& critters, std::size_t i) const {
+         return critters.getDistanceTravelled(i);
+     }
+ };
+ 
+ // Highest health
+ struct StrongestScore {
+     float operator()(const sf::Vector2f&, const CritterStore& critters, std::size_t i) const {
+         return critters.getHealth(i);
+     }
+ };
+ 
+ // Lowest positive health
+ struct WeakestScore {
+     float operator()(const sf::Vector2f&, const CritterStore& critters, std::size_t i) const {
+         float health = critters.getHealth(i);
+         return health > 0 ? -health : REJECT_TARGET;
+     }
+ };
+ 
+ // Closest to the tower; squared distances rank the same as distances
+ struct ClosestScore {
+     float operator()(const sf::Vector2f& towerPosition, const CritterStore& critters, std::size_t i) const {
+         float dx = critters.getX(i) - towerPosition.x;
+         float dy = critters.getY(i) - towerPosition.y;
+         return -(dx * dx + dy * dy);
+     }
+ };
+ 
+ // Weighted mix of exit proximity, strength and distance to the tower
+ struct SmartScore {
+     float operator()(const sf::Vector2f& towerPosition, const CritterStore& critters, std::size_t i) const {
+         float health = critters.getHealth(i);
+         float maxHealth = 800.0f; // Estimate of the maximum possible health
+         float dx = critters.getX(i) - towerPosition.x;
+         float dy = critters.getY(i) - towerPosition.y;
+         
+         // Calculate normalized factors (0.0 to 1.0)
+         float exitProximityFactor = critters.getProgress(i); // Higher = closer to exit
+         float strengthFactor = health / maxHealth; // Higher = stronger
+         float distanceFactor = 1.0f - (std::sqrt(dx * dx + dy * dy) / 200.0f); // Higher = closer to tower
+         
+         // Calculate priority score with exit proximity as highest priority
+         // Then strength, then proximity to tower
+         float priority = (exitProximityFactor * 3.0f) + (strengthFactor * 2.0f) + distanceFactor;
+         
+         // Give special priority to critters that are both strong and near the exit
+         if (exitProximityFactor > 0.7f && strengthFactor > 0.7f) {
+             priority *= 1.5f;
+         }
+         
+         return priority;
+     }
+ };
+ 
+ /**
+  * Fused target scan: visits the live critters within range of the tower
+  * once and keeps the first one with the highest score
+  */
+ template <typename Score>
+ CritterHandle scanForTarget(const Score& score,
+                             const sf::Vector2f& towerPosition,
+                             float range,
+                             const CritterStore& critters)
+ {
+     int bestTarget = -1;
+     float bestScore = REJECT_TARGET;
+     std::uint64_t scanned = 0;
+     
+     critters.queryRadius(towerPosition, range, [&](std::size_t i) {
+         if (critters.isDead(i)) return;
+         
+         ++scanned;
+         float candidate = score(towerPosition, critters, i);
+         if (candidate > bestScore) {
+             bestScore = candidate;
+             bestTarget = static_cast<int>(i);
+         }
+     });
+     
+     CounterRegistry::add(Counter::FIND_TARGET_CALLS);
+     CounterRegistry::add(Counter::CRITTERS_SCANNED, scanned);
+     return bestTarget >= 0 ? critters.handleAt(bestTarget) : CritterHandle();
+ }
+ 
+ /**
+  * Finds a target with the given strategy. Each case is its own
+  * instantiation of scanForTarget, so there is no per-critter virtual call.
+  */
+ CritterHandle findTargetWith(StrategyType type,
+                              const sf::Vector2f& towerPosition,
+                              float range,
+                              const CritterStore& critters);
+ 
  /**
   * Abstract base class for tower targeting strategies
   */
@@ -46,96 +164,44 @@
       * 
       * @param towerPosition Position of the tower
       * @param range Maximum range of the tower
-      * @param critters Vector of available critters to target
-      * @return Pointer to the best target, or nullptr if none found
+      * @param critters Store of available critters to target
+      * @return Handle to the best target, or a null handle if none found
       */
-     virtual Critter* findTarget(const sf::Vector2f& towerPosition, 
+     virtual CritterHandle findTarget(const sf::Vector2f& towerPosition, 
                                 float range,
-                                std::vector<std::unique_ptr<Critter>>& critters) = 0;
+                                const CritterStore& critters) const = 0;
                                 
      // Get the strategy type
      virtual StrategyType getStrategyType() const = 0;
-     
- protected:
-     // Utility function to calculate distance between two points
-     float calculateDistance(const sf::Vector2f& point1, const sf::Vector2f& point2) const;
  };
  
  /**
-  * Strategy that prioritizes critters closest to the exit
+  * Strategy wrapping one scoring policy. Strategies hold no state, so one
+  * instance of each is shared by every tower (see TargetingStrategyFactory).
   */
- class ExitProximityStrategy : public TargetingStrategy {
+ template <typename Score, StrategyType Type>
+ class ScoredTargetingStrategy : public TargetingStrategy {
  public:
-     Critter* findTarget(const sf::Vector2f& towerPosition, 
-                         float range,
-                         std::vector<std::unique_ptr<Critter>>& critters) override;
-     
-     StrategyType getStrategyType() const override { 
-         return StrategyType::EXIT_PROXIMITY; 
+     CritterHandle findTarget(const sf::Vector2f& towerPosition, 
+                              float range,
+                              const CritterStore& critters) const override {
+         return scanForTarget(Score(), towerPosition, range, critters);
      }
- };
- 
- /**
-  * Strategy that prioritizes strongest critters (highest health)
-  */
- class StrongestFirstStrategy : public TargetingStrategy {
- public:
-     Critter* findTarget(const sf::Vector2f& towerPosition, 
-                         float range,
-                         std::vector<std::unique_ptr<Critter>>& critters) override;
-                         
-     StrategyType getStrategyType() const override { 
-         return StrategyType::STRONGEST; 
-     }
- };
- 
- /**
-  * Strategy that prioritizes weakest critters (lowest health)
-  */
- class WeakestFirstStrategy : public TargetingStrategy {
- public:
-     Critter* findTarget(const sf::Vector2f& towerPosition, 
-                         float range,
-                         std::vector<std::unique_ptr<Critter>>& critters) override;
-                         
-     StrategyType getStrategyType() const override { 
-         return StrategyType::WEAKEST; 
-     }
- };
- 
- /**
-  * Strategy that prioritizes critters closest to the tower
-  */
- class ClosestFirstStrategy : public TargetingStrategy {
- public:
-     Critter* findTarget(const sf::Vector2f& towerPosition, 
-                         float range,
-                         std::vector<std::unique_ptr<Critter>>& critters) override;
-                         
-     StrategyType getStrategyType() const override { 
-         return StrategyType::CLOSEST; 
-     }
- };
- 
- /**
-  * A smart strategy that considers multiple factors to determine priority
-  */
- class SmartTargetingStrategy : public TargetingStrategy {
- public:
-     Critter* findTarget(const sf::Vector2f& towerPosition, 
-                         float range,
-                         std::vector<std::unique_ptr<Critter>>& critters) override;
      
      StrategyType getStrategyType() const override { 
-         return StrategyType::SMART; 
+         return Type; 
      }
-                         
- private:
-     // Calculate a priority score for a critter (higher = higher priority)
-     float calculatePriorityScore(const sf::Vector2f& towerPosition,
-                                  Critter* critter,
-                                  int currentWaypoint,
-                                  int maxWaypoint);
  };
  
+ // Strategy that prioritizes critters closest to the exit
+ using ExitProximityStrategy = ScoredTargetingStrategy<ExitProximityScore, StrategyType::EXIT_PROXIMITY>;
+ // Strategy that prioritizes strongest critters (highest health)
+ using StrongestFirstStrategy = ScoredTargetingStrategy<StrongestScore, StrategyType::STRONGEST>;
+ // Strategy that prioritizes weakest critters (lowest health)
+ using WeakestFirstStrategy = ScoredTargetingStrategy<WeakestScore, StrategyType::WEAKEST>;
+ // Strategy that prioritizes critters closest to the tower
+ using ClosestFirstStrategy = ScoredTargetingStrategy<ClosestScore, StrategyType::CLOSEST>;
+ // A smart strategy that considers multiple factors to determine priority
+ using SmartTargetingStrategy = ScoredTargetingStrategy<SmartScore, StrategyType::SMART>;
+ 
  #endif // TARGETING_STRATEGY_HPP
\ No newline at end of file
@@ -4,7 +4,9 @@
  * 
  * TargetingStrategyFactory.hpp - Factory for targeting strategies
  * 
- * Purpose: Provides a centralized way to create targeting strategy objects.
+ * Purpose: Provides a centralized way to look up targeting strategy objects
+ * and their display names. Strategies are stateless, so each type has one
+ * shared instance.
  * 
  * Dependencies: TargetingStrategy.hpp
  */
@@ -18,32 +20,38 @@
  #define TARGETING_STRATEGY_FACTORY_HPP
  
  #include "TargetingStrategy.hpp"
- #include <memory>
  #include <stdexcept>
+ #include <string>
  
  /**
-  * Factory class to create targeting strategy objects
+  * Factory class to look up targeting strategy objects
   */
  class TargetingStrategyFactory {
  public:
      /**
-      * Create a targeting strategy based on the given strategy type
+      * Get the shared targeting strategy for the given strategy type
       * 
-      * @param type The type of strategy to create
-      * @return A shared_ptr to the created strategy
+      * @param type The type of strategy to look up
+      * @return The strategy instance shared by every tower
       */
-     static std::shared_ptr<TargetingStrategy> createStrategy(StrategyType type) {
+     static const TargetingStrategy& getStrategy(StrategyType type) {
+         static const SmartTargetingStrategy smart;
+         static const ExitProximityStrategy exitProximity;
+         static const StrongestFirstStrategy strongest;
+         static const WeakestFirstStrategy weakest;
+         static const ClosestFirstStrategy closest;
+         
          switch (type) {
              case StrategyType::SMART:
-                 return std::make_shared<SmartTargetingStrategy>();
+                 return smart;
              case StrategyType::EXIT_PROXIMITY:
-                 return std::make_shared<ExitProximityStrategy>();
+                 return exitProximity;
              case StrategyType::STRONGEST:
-                 return std::make_shared<StrongestFirstStrategy>();
+                 return strongest;
              case StrategyType::WEAKEST:
-                 return std::make_shared<WeakestFirstStrategy>();
+                 return weakest;
              case StrategyType::CLOSEST:
-                 return std::make_shared<ClosestFirstStrategy>();
+                 return closest;
              default:
                  throw std::invalid_argument("Unknown strategy type");
          }
@@ -0,0 +1,58 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * TextureCache.cpp - Shared texture storage implementation
+ * 
+ * Purpose: Implements path-keyed texture lookup with decode-once semantics
+ * and hit/miss accounting.
+ * 
+ * Dependencies: TextureCache.hpp, TraceRecorder, MemoryTracker, stdexcept
+ */
+
+/**
+ * @file TextureCache.cpp
+ * @brief Implements the process-wide texture cache
+ */
+
+#include "TextureCache.hpp"
+#include "TraceRecorder.hpp"
+#include "MemoryTracker.hpp"
+#include <stdexcept>
+
+TextureCache& TextureCache::instance() {
+    static TextureCache cache;
+    return cache;
+}
+
+TextureCache::Handle TextureCache::acquire(const std::string& path, bool smooth) {
+    auto it = textures.find(path);
+    if (it != textures.end()) {
+        ++hits;
+        if (smooth) {
+            it->second->setSmooth(true);
+        }
+        return it->second;
+    }
+
+    ++misses;
+    TraceScope trace("texture load", "io", path.c_str());
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromFile(path)) {
+        throw std::runtime_error("ERROR: Could not load " + path + "! Ensure it exists.");
+    }
+    texture->setSmooth(smooth);
+    // Cached textures live until exit, so they are never released
+    sf::Vector2u size = texture->getSize();
+    MemoryTracker::allocated(MemoryTag::TEXTURES, static_cast<std::size_t>(size.x) * size.y * 4);
+    textures.emplace(path, texture);
+    return texture;
+}
+
+void TextureCache::preload(const std::vector<std::string>& paths) {
+    for (const auto& path : paths) {
+        if (textures.find(path) == textures.end()) {
+            acquire(path);
+        }
+    }
+}
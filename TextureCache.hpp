@@ -0,0 +1,58 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ * 
+ * TextureCache.hpp - Shared texture storage
+ * 
+ * Purpose: Decodes each texture file once per process and hands out
+ * reference-counted handles to it, so critters and towers share a single
+ * sf::Texture per path instead of loading their own copy.
+ * 
+ * Dependencies: SFML 3.0 (Graphics), string, unordered_map, memory
+ */
+/**
+ * @file TextureCache.hpp
+ * @brief Implementation of Texture Cache header file
+ */
+
+#ifndef TEXTURECACHE_HPP
+#define TEXTURECACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class TextureCache {
+public:
+    // Shared, read-only handle to a decoded texture
+    using Handle = std::shared_ptr<const sf::Texture>;
+
+    // Process-wide cache instance
+    static TextureCache& instance();
+
+    // Returns the texture for path, decoding it only on the first request.
+    // Throws std::runtime_error if the file cannot be loaded.
+    Handle acquire(const std::string& path, bool smooth = false);
+
+    // Decodes every listed texture up front so gameplay never hits the disk
+    void preload(const std::vector<std::string>& paths);
+
+    // Cache statistics: a miss is a PNG decode, a hit is a reused texture
+    std::size_t getHitCount() const { return hits; }
+    std::size_t getMissCount() const { return misses; }
+    std::size_t getTextureCount() const { return textures.size(); }
+
+private:
+    TextureCache() = default;
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> textures;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+};
+
+#endif // TEXTURECACHE_HPP
@@ -17,6 +17,7 @@
 #ifndef TILE_H
 #define TILE_H
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -24,7 +25,8 @@ using namespace std;
 
 class Tile {
 public:
-    enum class TileType { Path, Beginning, End, Tower, Scenery, Init };
+    // Stored 4 bits per tile in TileGrid, so at most 16 types
+    enum class TileType : std::uint8_t { Path, Beginning, End, Tower, Scenery, Init };
     Tile();
     Tile(int x, int y, TileType type);
 
@@ -0,0 +1,39 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * TileGrid.cpp - Packed map tile storage implementation
+ *
+ * Purpose: Implements resizing and writing the packed tile array.
+ *
+ * Dependencies: TileGrid.hpp, stdexcept
+ */
+
+/**
+ * @file TileGrid.cpp
+ * @brief Implementation of the Tile Grid
+ */
+
+#include "TileGrid.hpp"
+#include <stdexcept>
+
+void TileGrid::reset(int gridWidth, int gridHeight, Tile::TileType fill) {
+    if (gridWidth < 0 || gridHeight < 0) {
+        throw std::runtime_error("ERROR: Map dimensions cannot be negative");
+    }
+    width = gridWidth;
+    height = gridHeight;
+
+    // Both nibbles of every byte hold the fill type
+    std::uint8_t nibble = static_cast<std::uint8_t>(fill) & TILE_MASK;
+    std::size_t tileCount = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+    cells.assign((tileCount + 1) / 2, static_cast<std::uint8_t>(nibble | (nibble << BITS_PER_TILE)));
+}
+
+void TileGrid::set(int x, int y, Tile::TileType type) {
+    std::size_t index = indexOf(x, y);
+    unsigned shift = shiftOf(index);
+    std::uint8_t& cell = cells[index >> 1];
+    cell = static_cast<std::uint8_t>((cell & ~(TILE_MASK << shift)) |
+                                     ((static_cast<std::uint8_t>(type) & TILE_MASK) << shift));
+}
@@ -0,0 +1,72 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * TileGrid.hpp - Packed map tile storage
+ *
+ * Purpose: Stores the map as one contiguous row-major array of tile types,
+ * packed two tiles per byte. Tile coordinates are implied by the index, so
+ * a 4000x4000 custom map takes 8 MB, and checking a tile is a single
+ * indexed load.
+ *
+ * Dependencies: Tile, MemoryTracker, vector, cstdint
+ */
+/**
+ * @file TileGrid.hpp
+ * @brief Implementation of Tile Grid header file
+ */
+
+#ifndef TILEGRID_HPP
+#define TILEGRID_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "MemoryTracker.hpp"
+#include "Tile.h"
+
+class TileGrid {
+public:
+    static constexpr int BITS_PER_TILE = 4;
+
+    // Resizes the grid to width x height and sets every tile to fill
+    void reset(int gridWidth, int gridHeight, Tile::TileType fill = Tile::TileType::Scenery);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    bool inBounds(int x, int y) const { return x >= 0 && x < width && y >= 0 && y < height; }
+
+    // Tile type at (x, y); the position must be in bounds
+    Tile::TileType get(int x, int y) const {
+        std::size_t index = indexOf(x, y);
+        return static_cast<Tile::TileType>((cells[index >> 1] >> shiftOf(index)) & TILE_MASK);
+    }
+    void set(int x, int y, Tile::TileType type);
+
+    // True for tiles critters walk on (path, beginning, end). Out of bounds is not path.
+    bool isPath(int x, int y) const {
+        return inBounds(x, y) && ((PATH_TYPES >> static_cast<unsigned>(get(x, y))) & 1u) != 0;
+    }
+
+    // Bytes of tile storage
+    std::size_t getByteSize() const { return cells.size(); }
+
+private:
+    static constexpr std::uint8_t TILE_MASK = (1u << BITS_PER_TILE) - 1;
+    // Bit per TileType value that counts as walkable path
+    static constexpr unsigned PATH_TYPES =
+        (1u << static_cast<unsigned>(Tile::TileType::Path)) |
+        (1u << static_cast<unsigned>(Tile::TileType::Beginning)) |
+        (1u << static_cast<unsigned>(Tile::TileType::End));
+
+    std::size_t indexOf(int x, int y) const {
+        return static_cast<std::size_t>(y) * static_cast<std::size_t>(width) + static_cast<std::size_t>(x);
+    }
+    static unsigned shiftOf(std::size_t index) { return (index & 1u) * BITS_PER_TILE; }
+
+    int width = 0;
+    int height = 0;
+    TrackedVector<std::uint8_t, MemoryTag::MAP> cells;
+};
+
+#endif // TILEGRID_HPP
@@ -2,12 +2,13 @@
  * Tower Defense Game
  * Ryan Sefrioui - Sanjai Ratnarajah
  * 
- * TowerDecoratorFactory.hpp - Factory for creating tower decorators
+ * TowerDecoratorFactory.hpp - Factory for tower upgrade modifiers
  * 
- * Purpose: Provides a centralized way to apply decorators to towers
- * based on upgrade type or special conditions.
+ * Purpose: Provides a centralized way to decorate towers with upgrade
+ * effects based on upgrade type or tower level. Each upgrade appends
+ * TowerModifiers to the tower instead of wrapping it in another object.
  * 
- * Dependencies: ConcreteDecorators.hpp
+ * Dependencies: tower.hpp, TowerModifier.hpp
  */
 /**
  * @file TowerDecoratorFactory.hpp
@@ -15,7 +16,8 @@
  */
 
  #pragma once
- #include "ConcreteDecorators.hpp"
+ #include "tower.hpp"
+ #include "TowerModifier.hpp"
  #include <string>
  #include <memory>
  
@@ -31,76 +33,85 @@
          REFUND_BOOST
      };
  
-     // Factory method to apply decorator based on upgrade type
-     static Tower* applyUpgrade(Tower* baseTower, UpgradeType upgradeType) {
+     // Factory method to add the modifiers of an upgrade type with its default strength
+     static void applyUpgrade(Tower& tower, UpgradeType upgradeType) {
          switch (upgradeType) {
              case RANGE_BOOST:
-                 return new RangeUpgradeDecorator(baseTower);
+                 rangeBoost(tower, 1.3f);
+                 break;
              case POWER_BOOST:
-                 return new PowerUpgradeDecorator(baseTower);
+                 powerBoost(tower, 1.5f);
+                 break;
              case FIRE_RATE_BOOST:
-                 return new FireRateUpgradeDecorator(baseTower);
+                 fireRateBoost(tower, 1.4f);
+                 break;
              case LEVEL3_FOCUS:
-                 return new Level3CritterFocusDecorator(baseTower);
+                 level3Focus(tower);
+                 break;
              case AOE_ENHANCE:
-                 return new AoERadiusEnhancerDecorator(baseTower);
+                 aoeEnhance(tower, 1.4f);
+                 break;
              case REFUND_BOOST:
-                 return new RefundValueBoosterDecorator(baseTower);
-             default:
-                 return baseTower; // No decorator applied
+                 refundBoost(tower, 1.2f);
+                 break;
          }
      }
      
-     // Apply decorator based on tower level and type
-     static Tower* applyLevelUpgrade(Tower* baseTower) {
-         int currentLevel = baseTower->getLevel();
-         Tower::Type towerType = baseTower->getTowerType();
+     // Levels the tower up and adds the effects for its type and new level.
+     // Returns false if the tower is already at max level.
+     static bool applyLevelUpgrade(Tower& tower) {
+         int currentLevel = tower.getLevel();
+         Tower::Type towerType = tower.getTowerType();
+
+         if (!tower.upgrade()) {
+             return false;
+         }
          
-         // Apply different decorators based on tower level and type
+         // Apply different upgrades based on tower level and type
          switch (currentLevel) {
              case 1:
                  // Level 1 to 2 upgrades
                  if (towerType == Tower::Type::BASIC) {
                      // Basic towers get range and fire rate
-                     baseTower = new RangeUpgradeDecorator(baseTower, 1.2f);
-                     baseTower = new FireRateUpgradeDecorator(baseTower, 1.3f);
+                     rangeBoost(tower, 1.2f);
+                     fireRateBoost(tower, 1.3f);
                  }
                  else if (towerType == Tower::Type::AREA) {
                      // Area towers get enhanced AoE and power
-                     baseTower = new AoERadiusEnhancerDecorator(baseTower, 1.3f);
-                     baseTower = new PowerUpgradeDecorator(baseTower, 1.4f);
+                     aoeEnhance(tower, 1.3f);
+                     powerBoost(tower, 1.4f);
                  }
                  else if (towerType == Tower::Type::SPECIAL) {
                      // Special towers get power and level 3 focus
-                     baseTower = new PowerUpgradeDecorator(baseTower, 1.6f);
-                     baseTower = new Level3CritterFocusDecorator(baseTower);
+                     powerBoost(tower, 1.6f);
+                     level3Focus(tower);
                  }
                  break;
                  
              case 2:
                  // Level 2 to 3 upgrades (more powerful)
                  if (towerType == Tower::Type::BASIC) {
-                     baseTower = new RangeUpgradeDecorator(baseTower, 1.3f);
-                     baseTower = new PowerUpgradeDecorator(baseTower, 1.5f);
-                     baseTower = new FireRateUpgradeDecorator(baseTower, 1.4f);
+                     rangeBoost(tower, 1.3f);
+                     powerBoost(tower, 1.5f);
+                     fireRateBoost(tower, 1.4f);
                  }
                  else if (towerType == Tower::Type::AREA) {
-                     baseTower = new AoERadiusEnhancerDecorator(baseTower, 1.5f);
-                     baseTower = new PowerUpgradeDecorator(baseTower, 1.6f);
-                     baseTower = new RefundValueBoosterDecorator(baseTower, 1.3f);
+                     aoeEnhance(tower, 1.5f);
+                     powerBoost(tower, 1.6f);
+                     refundBoost(tower, 1.3f);
                  }
                  else if (towerType == Tower::Type::SPECIAL) {
-                     baseTower = new PowerUpgradeDecorator(baseTower, 2.0f);
-                     baseTower = new Level3CritterFocusDecorator(baseTower);
-                     baseTower = new FireRateUpgradeDecorator(baseTower, 1.5f);
+                     powerBoost(tower, 2.0f);
+                     level3Focus(tower);
+                     fireRateBoost(tower, 1.5f);
                  }
                  break;
          }
          
-         return baseTower;
+         return true;
      }
      
-     // Create a fully decorated tower in one step for pre-built upgrades
+     // Create a fully upgraded tower in one step for pre-built upgrades
      static std::unique_ptr<Tower> createDecoratedTower(const sf::Vector2f& position, Tower::Type towerType, int upgradeLevel) {
          // Base tower properties based on type
          int cost;
@@ -123,6 +134,7 @@
                  texturePath = "textures/area1.png";
                  break;
              case Tower::Type::SPECIAL:
+             default:
                  cost = 125;
                  range = 140.f;
                  power = 85.f;
@@ -132,14 +144,46 @@
          }
          
          // Create base tower
-         Tower* tower = new Tower(position, cost, range, power, fireRate, texturePath, towerType);
+         auto tower = std::make_unique<Tower>(position, cost, range, power, fireRate, texturePath, towerType);
          
          // Apply upgrades based on requested level
          for (int i = 1; i < upgradeLevel; i++) {
-             tower->upgrade(); // Level up the tower visually
-             tower = applyLevelUpgrade(tower); // Apply appropriate decorators
+             applyLevelUpgrade(*tower);
          }
          
-         return std::unique_ptr<Tower>(tower);
+         return tower;
+     }
+
+ private:
+     // Each upgrade also makes the tower's next level more expensive
+     static void rangeBoost(Tower& tower, float factor) {
+         tower.addModifiers({{TowerModifier::Stat::RANGE, factor},
+                             {TowerModifier::Stat::UPGRADE_COST, 1.2f}});
+     }
+
+     static void powerBoost(Tower& tower, float factor) {
+         tower.addModifiers({{TowerModifier::Stat::POWER, factor},
+                             {TowerModifier::Stat::UPGRADE_COST, 1.3f}});
+     }
+
+     static void fireRateBoost(Tower& tower, float factor) {
+         tower.addModifiers({{TowerModifier::Stat::FIRE_RATE, factor},
+                             {TowerModifier::Stat::UPGRADE_COST, 1.25f}});
+     }
+
+     // Shoots level 3 critters first and grants a small power boost
+     static void level3Focus(Tower& tower) {
+         tower.addModifiers({{TowerModifier::Stat::LEVEL3_FOCUS, 1.0f},
+                             {TowerModifier::Stat::POWER, 1.2f}});
+     }
+
+     // Larger splash, plus a slight range increase
+     static void aoeEnhance(Tower& tower, float factor) {
+         tower.addModifiers({{TowerModifier::Stat::AOE_RADIUS, factor},
+                             {TowerModifier::Stat::RANGE, 1.1f}});
+     }
+
+     static void refundBoost(Tower& tower, float factor) {
+         tower.addModifier({TowerModifier::Stat::REFUND_VALUE, factor});
      }
- };
\ No newline at end of file
+ };
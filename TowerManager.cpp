@@ -7,7 +7,7 @@
  * Purpose: Implements tower placement logic, upgrade mechanics,
  * and coordinates tower-enemy interactions.
  * 
- * Dependencies: SFML 3.0, TowerManager.hpp, cmath, iostream
+ * Dependencies: SFML 3.0, TowerManager.hpp, TraceRecorder, cmath, iostream
  */
 
  /**
@@ -23,19 +23,56 @@
  #include <stdexcept>
  #include "TowerDecoratorFactory.hpp"
  #include "TargetingStrategyFactory.hpp"
+ #include "TraceRecorder.hpp"
 
-TowerManager::TowerManager(MapGenerator& mapRef, CritterSpawner& spawnerRef)
-    : mapGenerator(mapRef)
+TowerManager::TowerManager(MapGenerator& mapRef, CritterSpawner& spawnerRef, ProjectileSystem& projectileRef)
+    : Observable(Counter::NOTIFY_TOWERS)
+    , mapGenerator(mapRef)
     , spawner(spawnerRef)
+    , projectiles(projectileRef)
 {
 }
 
+void TowerManager::reset() {
+    towers.clear();
+    freeTowerSlots.clear();
+    std::fill(occupancy.begin(), occupancy.end(), NO_TOWER);
+}
+
+void TowerManager::syncOccupancyGrid() {
+    const TileGrid& map = mapGenerator.getMap();
+    if (map.getWidth() == gridWidth && map.getHeight() == gridHeight) {
+        return;
+    }
+    gridWidth = map.getWidth();
+    gridHeight = map.getHeight();
+    occupancy.assign(static_cast<std::size_t>(gridWidth) * gridHeight, NO_TOWER);
+    towers.clear();
+    freeTowerSlots.clear();
+}
+
+int TowerManager::tileIndexOf(const sf::Vector2f& position) const {
+    int gridX = static_cast<int>(std::floor(position.x / TILE_SIZE));
+    int gridY = static_cast<int>(std::floor(position.y / TILE_SIZE));
+    if (gridX < 0 || gridX >= gridWidth || gridY < 0 || gridY >= gridHeight) {
+        return -1;
+    }
+    return gridY * gridWidth + gridX;
+}
+
+int TowerManager::towerSlotAt(const sf::Vector2f& position) const {
+    int tile = tileIndexOf(position);
+    return tile >= 0 ? occupancy[tile] : NO_TOWER;
+}
+
 bool TowerManager::canPlaceTower(const sf::Vector2f& position) const {
-    return !isPositionOnPath(position) && !isTowerPresent(position);
+    // Towers can only stand on free, non-path tiles of the map
+    return tileIndexOf(position) >= 0 && !isPositionOnPath(position) && !isTowerPresent(position);
 }
 
 bool TowerManager::tryPlaceTower(const sf::Vector2f& position, int towerType) {
     sf::Vector2f snappedPos = snapToGrid(position);
+    syncOccupancyGrid();
     
     if (!canPlaceTower(snappedPos)) {
         return false;
@@ -82,7 +119,7 @@ bool TowerManager::tryPlaceTower(const sf::Vector2f& position, int towerType) {
     }
 
     try {
-        towers.push_back(std::make_unique<Tower>(
+        auto tower = std::make_unique<Tower>(
             snappedPos,
             cost,
             range,
@@ -90,7 +127,19 @@ bool TowerManager::tryPlaceTower(const sf::Vector2f& position, int towerType) {
             fireRate,
             texturePath,
             type
-        ));
+        );
+
+        // Reuse a sold tower's slot if there is one
+        int slot;
+        if (!freeTowerSlots.empty()) {
+            slot = freeTowerSlots.back();
+            freeTowerSlots.pop_back();
+            towers[slot] = std::move(tower);
+        } else {
+            slot = static_cast<int>(towers.size());
+            towers.push_back(std::move(tower));
+        }
+        occupancy[tileIndexOf(snappedPos)] = slot;
 
         spawner.adjustPlayerCurrency(-cost);
         notify();
@@ -103,37 +152,21 @@ bool TowerManager::tryPlaceTower(const sf::Vector2f& position, int towerType) {
 }
 
 bool TowerManager::tryUpgradeTower(const sf::Vector2f& position) {
-    sf::Vector2f snappedPos = snapToGrid(position);
-    
     // Find the tower at this position
-    auto it = std::find_if(towers.begin(), towers.end(),
-        [&snappedPos](const std::unique_ptr<Tower>& tower) {
-            return tower->getPosition() == snappedPos;
-        });
-    
-    if (it == towers.end() || !(*it)->canUpgrade()) {
+    Tower* tower = getTowerAt(position);
+    if (!tower || !tower->canUpgrade()) {
         return false;
     }
 
-    // Get upgrade cost before applying decorators
-    int upgradeCost = (*it)->getUpgradeCost();
+    // Get upgrade cost before adding this level's modifiers
+    int upgradeCost = tower->getUpgradeCost();
     if (spawner.getPlayerCurrency() < upgradeCost) {
         return false;
     }
 
     try {
-      
-        
-        // Apply the base upgrade first to update visuals
-        if ((*it)->upgrade()) {
-            // Apply decorators based on tower level and type
-            Tower* upgradedTower = it->release(); // Release ownership from unique_ptr
-            upgradedTower = TowerDecoratorFactory::applyLevelUpgrade(upgradedTower);
-            
-            // Replace the tower with the decorated version
-            it = towers.erase(it);
-            towers.push_back(std::unique_ptr<Tower>(upgradedTower));
-            
+        // Level the tower up in place and add its type's upgrade modifiers
+        if (TowerDecoratorFactory::applyLevelUpgrade(*tower)) {
             spawner.adjustPlayerCurrency(-upgradeCost);
             notify();
             return true;
@@ -154,15 +187,12 @@ bool TowerManager::trySellTower(const sf::Vector2f& position) {
     
     // Safe tower selling with error handling
     try {
-        // Find the tower index
-        auto it = std::find_if(towers.begin(), towers.end(), 
-            [&snappedPos](const std::unique_ptr<Tower>& tower) {
-                return tower->getPosition() == snappedPos;
-            });
+        // Find the tower's slot
+        int slot = towerSlotAt(snappedPos);
         
         // If tower found, sell it
-        if (it != towers.end()) {
-            int refundAmount = (*it)->getRefundValue();
+        if (slot != NO_TOWER) {
+            int refundAmount = towers[slot]->getRefundValue();
             
             // Debug logging
             std::cout << "Tower sold at position (" 
@@ -173,8 +203,10 @@ bool TowerManager::trySellTower(const sf::Vector2f& position) {
             // Adjust currency before erasing to prevent potential state issues
             spawner.adjustPlayerCurrency(refundAmount);
             
-            // Erase the tower
-            towers.erase(it);
+            // Free the tower's slot and tile
+            towers[slot].reset();
+            freeTowerSlots.push_back(slot);
+            occupancy[tileIndexOf(snappedPos)] = NO_TOWER;
             notify();
             return true;
         }
@@ -197,14 +229,8 @@ bool TowerManager::trySellTower(const sf::Vector2f& position) {
 }
 
 Tower* TowerManager::getTowerAt(const sf::Vector2f& position) {
-    sf::Vector2f snappedPos = snapToGrid(position);
-    
-    for (auto& tower : towers) {
-        if (tower->getPosition() == snappedPos) {
-            return tower.get();
-        }
-    }
-    return nullptr;
+    int slot = towerSlotAt(position);
+    return slot != NO_TOWER ? towers[slot].get() : nullptr;
 }
 
 sf::Vector2f TowerManager::snapToGrid(const sf::Vector2f& position) const {
@@ -215,9 +241,14 @@ sf::Vector2f TowerManager::snapToGrid(const sf::Vector2f& position) const {
 
 void TowerManager::update(float deltaTime) {
     try {
-        for (auto& tower : towers) {
+        for (std::size_t slot = 0; slot < towers.size(); ++slot) {
+            Tower* tower = towers[slot].get();
+            if (!tower) continue;
+            // Traced per slot so a slow tower stands out in the trace viewer.
+            // These are most of the ring's events; startup events are kept apart.
+            TraceScope trace("tower", "sim", nullptr, static_cast<int>(slot));
             tower->update(deltaTime);
-            tower->findAndShootTarget(spawner.getActiveCritters());
+            tower->findAndShootTarget(spawner.getCritters(), spawner.getSummary(), projectiles);
         }
     }
     catch (const std::exception& e) {
@@ -228,8 +259,11 @@ void TowerManager::update(float deltaTime) {
 void TowerManager::draw(sf::RenderWindow& window) const {
     try {
         for (const auto& tower : towers) {
+            if (!tower) continue;
             tower->draw(window);
         }
+        // Projectiles go on top of every tower, blended between simulation steps
+        projectiles.draw(window, interpolationAlpha);
     }
     catch (const std::exception& e) {
         std::cerr << "Error during tower drawing: " << e.what() << std::endl;
@@ -241,44 +275,27 @@ bool TowerManager::isPositionOnPath(const sf::Vector2f& position) const {
     int gridX = static_cast<int>(position.x / TILE_SIZE);
     int gridY = static_cast<int>(position.y / TILE_SIZE);
 
-    // Get the map from MapGenerator
-    std::vector<std::vector<Tile>> gameMap = mapGenerator.getMap();
-
-    // Check if the coordinates are within the map bounds
-    if (gridY < 0 || gridY >= static_cast<int>(gameMap.size()) || 
-        gridX < 0 || gridX >= static_cast<int>(gameMap[0].size())) {
-        return false;
-    }
-
-    // Check if the tile at this position is a path tile
-    return gameMap[gridY][gridX].getType() == Tile::TileType::Path ||
-           gameMap[gridY][gridX].getType() == Tile::TileType::Beginning ||
-           gameMap[gridY][gridX].getType() == Tile::TileType::End;
+    // Path, beginning and end tiles block placement; positions off the map do not
+    return mapGenerator.getMap().isPath(gridX, gridY);
 }
 
 bool TowerManager::isTowerPresent(const sf::Vector2f& position) const {
-    sf::Vector2f snappedPos = snapToGrid(position);
-    for (const auto& tower : towers) {
-        if (tower->getPosition() == snappedPos) {
-            return true;
-        }
-    }
-    return false;
+    return towerSlotAt(position) != NO_TOWER;
 }
 
 // Tower Inspect Method
 Tower* TowerManager::getTowerUnderMouse(const sf::Vector2f& mousePos) const {
-    for (const auto& tower : towers) {
-        sf::Vector2f towerPos = tower->getPosition();
-        float distance = std::sqrt(
-            std::pow(mousePos.x - towerPos.x, 2.0f) + 
-            std::pow(mousePos.y - towerPos.y, 2.0f)
-        );
-        
-        // If mouse is within a reasonable radius of tower (half a tile)
-        if (distance <= TILE_SIZE / 2.0f) {
-            return tower.get();
-        }
+    // Only the tower on the tile under the mouse can be within half a tile of it
+    int slot = towerSlotAt(mousePos);
+    if (slot == NO_TOWER) {
+        return nullptr;
+    }
+
+    Tower* tower = towers[slot].get();
+    sf::Vector2f offset = mousePos - tower->getPosition();
+    const float HIT_RADIUS = TILE_SIZE / 2.0f;
+    if (offset.x * offset.x + offset.y * offset.y <= HIT_RADIUS * HIT_RADIUS) {
+        return tower;
     }
     return nullptr;
 }
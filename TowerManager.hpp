@@ -5,9 +5,10 @@
  * TowerManager.hpp - Tower placement and management
  * 
  * Purpose: Handles tower placement validation, upgrading, selling,
- * and coordinates tower interactions with enemies.
+ * and coordinates tower interactions with enemies. A per-tile occupancy
+ * grid maps each map tile to the slot of the tower standing on it.
  * 
- * Dependencies: SFML 3.0, Tower, MapGenerator, CritterSpawner, Observer.hpp
+ * Dependencies: SFML 3.0, Tower, MapGenerator, CritterSpawner, ProjectileSystem, Observer.hpp, MemoryTracker
  */
 /**
  * @file TowerManager.hpp
@@ -19,8 +20,10 @@
  #include <vector>
  #include <memory>
  #include "tower.hpp"
+ #include "MemoryTracker.hpp"
  #include "MapGenerator.h"
  #include "CritterSpawner.hpp"
+ #include "ProjectileSystem.hpp"
  #include "Observer.hpp"
  #include "TowerDecoratorFactory.hpp"
  #include "TargetingStrategy.hpp"
@@ -28,22 +31,23 @@
 
 class TowerManager : public Observable {
 public:
-    TowerManager(MapGenerator& mapRef, CritterSpawner& spawnerRef);
+    TowerManager(MapGenerator& mapRef, CritterSpawner& spawnerRef, ProjectileSystem& projectileRef);
     
     bool canPlaceTower(const sf::Vector2f& position) const;
     bool tryPlaceTower(const sf::Vector2f& position, int towerType);
     bool tryUpgradeTower(const sf::Vector2f& position);
     bool trySellTower(const sf::Vector2f& position);
-    void reset() {
-        towers.clear();
-    }
+    void reset();
     bool applyTowerDecorator(const sf::Vector2f& position, TowerDecoratorFactory::UpgradeType upgradeType);
     Tower* getTowerAt(const sf::Vector2f& position); // Returns false if max level
     sf::Vector2f snapToGrid(const sf::Vector2f& position) const; // Returns false if no tower
     
     void update(float deltaTime);
     void draw(sf::RenderWindow& window) const;
+    // Fraction of a simulation step elapsed since the last update, used by draw()
+    void setInterpolationAlpha(float alpha) { interpolationAlpha = alpha; }
     Tower* getTowerUnderMouse(const sf::Vector2f& mousePos) const; // Tower Inspect
+    std::size_t getTowerCount() const { return towers.size() - freeTowerSlots.size(); }
 
    
 
@@ -51,10 +55,26 @@ private:
     static constexpr int TILE_SIZE = 64;
     static constexpr int BASIC_TOWER_COST = 100;
     
-    std::vector<std::unique_ptr<Tower>> towers;
+    static constexpr int NO_TOWER = -1;
+
+    // Towers by stable slot id; a sold tower leaves an empty slot for reuse
+    TrackedVector<std::unique_ptr<Tower>, MemoryTag::TOWERS> towers;
+    TrackedVector<int, MemoryTag::TOWERS> freeTowerSlots;
+    // Slot id of the tower on each map tile (row-major), or NO_TOWER
+    TrackedVector<int, MemoryTag::TOWERS> occupancy;
+    int gridWidth = 0;
+    int gridHeight = 0;
     MapGenerator& mapGenerator;
     CritterSpawner& spawner;
+    ProjectileSystem& projectiles;
+    float interpolationAlpha = 1.0f;
 
     bool isPositionOnPath(const sf::Vector2f& position) const;
     bool isTowerPresent(const sf::Vector2f& position) const;
+    // Sizes the occupancy grid to the current map, dropping any towers if it changed
+    void syncOccupancyGrid();
+    // Row-major tile index under position, or -1 if it is off the map
+    int tileIndexOf(const sf::Vector2f& position) const;
+    // Slot id of the tower on the tile under position, or NO_TOWER
+    int towerSlotAt(const sf::Vector2f& position) const;
 };
\ No newline at end of file
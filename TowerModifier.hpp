@@ -0,0 +1,47 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * TowerModifier.hpp - Tower upgrade modifiers and effective stats
+ *
+ * Purpose: Describes a tower upgrade as a flat list of stat multipliers
+ * instead of a chain of wrapper objects. A tower folds its modifiers into
+ * an EffectiveStats block once per upgrade, and targeting and firing read
+ * that block directly.
+ *
+ * Dependencies: cstdint
+ */
+/**
+ * @file TowerModifier.hpp
+ * @brief Implementation of Tower Modifier header file
+ */
+
+ #pragma once
+ #include <cstdint>
+
+// One upgrade effect: multiplies a single stat by factor
+struct TowerModifier {
+    enum class Stat : std::uint8_t {
+        RANGE,
+        POWER,
+        FIRE_RATE,
+        AOE_RADIUS,
+        UPGRADE_COST,   // Scales the price of the next upgrade
+        REFUND_VALUE,   // Scales the sell price
+        LEVEL3_FOCUS    // Flag: shoot level 3 critters first (factor unused)
+    };
+
+    Stat stat;
+    float factor = 1.0f;
+};
+
+// Tower stats with every modifier applied
+struct EffectiveStats {
+    float range = 0.0f;
+    float power = 0.0f;
+    float fireRate = 0.0f;
+    float aoeRadius = 0.0f;
+    float upgradeCostFactor = 1.0f;
+    float refundFactor = 1.0f;
+    bool level3Focus = false;
+};
@@ -30,6 +30,7 @@ class TowerObserver : public IObserver {
 private:
     TowerManager* subject;
     sf::RenderWindow* window;
+    bool changed = true;  // Nothing has been rendered yet
 
 public:
     TowerObserver(TowerManager* tm, sf::RenderWindow* win)
@@ -42,9 +43,21 @@ public:
         subject->removeObserver(this);
     }
 
+    // Only records that the towers changed; drawing belongs to render()
     void update() override {
-        subject->draw(*window);
+        changed = true;
     }
+
+    // Render phase: draws the subject and clears the change record
+    void render() {
+        if (window && subject) {
+            subject->draw(*window);
+        }
+        changed = false;
+    }
+
+    // True if the subject reported a change since the last render()
+    bool hasChanged() const { return changed; }
 };
 
 #endif // TOWEROBSERVER_H
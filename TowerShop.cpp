@@ -7,7 +7,7 @@
  * Purpose: Implements tower purchase UI, selection handling,
  * and shop menu system.
  * 
- * Dependencies: SFML 3.0, TowerShop.hpp, iostream
+ * Dependencies: SFML 3.0, TowerShop.hpp, FrameProfiler, TraceRecorder, iostream
  */
 
  /**
@@ -16,6 +16,8 @@
  */
 
 #include "TowerShop.hpp"
+#include "FrameProfiler.hpp"
+#include "TraceRecorder.hpp"
 #include <iostream>
 
 TowerShop::TowerShop(TowerManager& towerManager, const sf::RenderWindow& window)
@@ -26,8 +28,12 @@ TowerShop::TowerShop(TowerManager& towerManager, const sf::RenderWindow& window)
     , shopButtonText(font)
     , closeButtonText(font)
 {
-    if (!font.openFromFile("fonts/arial.ttf")) {
-        throw std::runtime_error("Could not load font for shop!");
+    TraceScope trace("shop setup", "startup");
+    {
+        TraceScope fontTrace("font load", "io", "fonts/arial.ttf");
+        if (!font.openFromFile("fonts/arial.ttf")) {
+            throw std::runtime_error("Could not load font for shop!");
+        }
     }
 
     initializeTowerTypes();
@@ -169,6 +175,8 @@ void TowerShop::draw(sf::RenderWindow& window) {
             window.draw(towerDescriptions[i]);
         }
     }
+    FrameProfiler::instance().countDrawCalls(
+        shopOpen ? static_cast<std::uint32_t>(5 + 3 * towerButtons.size()) : 2);
 }
 
 bool TowerShop::isMouseOverShopButton(const sf::Vector2f& mousePos) const {
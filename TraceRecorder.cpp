@@ -0,0 +1,158 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * TraceRecorder.cpp - Scoped trace events implementation
+ *
+ * Purpose: Implements the kept buffer, the event ring and the Chrome
+ * trace-event JSON writer. Timestamps are written in microseconds with nanosecond precision,
+ * as the format expects.
+ *
+ * Dependencies: TraceRecorder.hpp, cstdio, cstring, fstream, ostream, stdexcept
+ */
+
+/**
+ * @file TraceRecorder.cpp
+ * @brief Implements the process-wide trace recorder
+ */
+
+#include "TraceRecorder.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+
+namespace {
+
+// Writes s as a JSON string literal
+void writeJsonString(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s; ++s) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\') {
+            out << '\\' << *s;
+        } else if (c < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out << escaped;
+        } else {
+            out << *s;
+        }
+    }
+    out << '"';
+}
+
+// Nanoseconds as fractional microseconds
+void writeMicroseconds(std::ostream& out, std::int64_t ns) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(ns) / 1000.0);
+    out << buffer;
+}
+
+} // namespace
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::start(std::size_t capacity) {
+    if (capacity == 0) {
+        throw std::runtime_error("Trace capacity must be at least one event");
+    }
+    kept.clear();
+    kept.reserve(KEPT_CAPACITY);
+    ring.assign(capacity, Event{});
+    next = 0;
+    count = 0;
+    dropped = 0;
+    origin = Clock::now();
+    enabled = true;
+}
+
+bool TraceRecorder::isKeptCategory(const char* category) {
+    return std::strcmp(category, "startup") == 0 || std::strcmp(category, "io") == 0;
+}
+
+void TraceRecorder::record(const char* name, const char* category,
+                           Clock::time_point begin, Clock::time_point end,
+                           const char* detail, int id) {
+    if (!enabled) return;
+
+    // Kept events never wrap; once the buffer is full they share the ring
+    bool keep = isKeptCategory(category) && kept.size() < kept.capacity();
+    if (keep) {
+        kept.emplace_back();
+    }
+    Event& event = keep ? kept.back() : ring[next];
+    event.name = name;
+    event.category = category;
+    event.beginNs = std::chrono::duration_cast<std::chrono::nanoseconds>(begin - origin).count();
+    event.durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    event.id = id;
+
+    std::size_t length = 0;
+    if (detail) {
+        for (; detail[length] && length + 1 < DETAIL_SIZE; ++length) {
+            event.detail[length] = detail[length];
+        }
+    }
+    event.detail[length] = '\0';
+    if (keep) return;
+
+    next = (next + 1) % ring.size();
+    if (count < ring.size()) {
+        ++count;
+    } else {
+        ++dropped;
+    }
+}
+
+void TraceRecorder::writeJson(std::ostream& out) const {
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Tower Defense\"}},\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}";
+
+    auto writeEvent = [&out](const Event& event) {
+        out << ",\n{\"name\":";
+        writeJsonString(out, event.name);
+        out << ",\"cat\":";
+        writeJsonString(out, event.category);
+        out << ",\"ph\":\"X\",\"ts\":";
+        writeMicroseconds(out, event.beginNs);
+        out << ",\"dur\":";
+        writeMicroseconds(out, event.durationNs);
+        out << ",\"pid\":1,\"tid\":1";
+
+        if (event.detail[0] != '\0' || event.id >= 0) {
+            out << ",\"args\":{";
+            if (event.detail[0] != '\0') {
+                out << "\"detail\":";
+                writeJsonString(out, event.detail);
+            }
+            if (event.id >= 0) {
+                out << (event.detail[0] != '\0' ? "," : "") << "\"id\":" << event.id;
+            }
+            out << '}';
+        }
+        out << '}';
+    };
+
+    for (const Event& event : kept) {
+        writeEvent(event);
+    }
+    std::size_t first = (next + ring.size() - count) % (ring.empty() ? 1 : ring.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        writeEvent(ring[(first + i) % ring.size()]);
+    }
+    out << "\n]}\n";
+}
+
+void TraceRecorder::dump(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not write trace file: " + path);
+    }
+    writeJson(file);
+}
@@ -0,0 +1,121 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * TraceRecorder.hpp - Scoped trace events in a ring buffer
+ *
+ * Purpose: Records named, timed scopes (startup work, frame phases, tower
+ * updates, texture loads) into a fixed ring that keeps the newest events.
+ * Startup and I/O events go to a separate buffer that never wraps, so the
+ * per-frame events cannot overwrite them. Both can be written out as Chrome
+ * trace-event JSON, which opens in chrome://tracing or Perfetto. Both are
+ * allocated once, when recording starts, so recording itself never
+ * allocates. Used from the main thread only.
+ *
+ * Dependencies: chrono, cstdint, string, vector
+ */
+/**
+ * @file TraceRecorder.hpp
+ * @brief Implementation of Trace Recorder header file
+ */
+
+#ifndef TRACERECORDER_HPP
+#define TRACERECORDER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class TraceRecorder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Each tower adds an event per 120 Hz step, so with the full Easy grid
+    // (231 towers, about 28k events/s) this holds the last 2.3 seconds
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 16;
+    // Startup and I/O events kept for the whole run; later ones use the ring
+    static constexpr std::size_t KEPT_CAPACITY = 1024;
+    // Longest detail string kept per event, including the terminator
+    static constexpr std::size_t DETAIL_SIZE = 40;
+
+    // Process-wide recorder instance
+    static TraceRecorder& instance();
+
+    // Allocates both buffers and starts recording; timestamps count from here
+    void start(std::size_t capacity = DEFAULT_CAPACITY);
+    void stop() { enabled = false; }
+    bool isEnabled() const { return enabled; }
+
+    // Adds one complete event. name and category must be string literals;
+    // detail is copied (truncated to DETAIL_SIZE - 1). id < 0 means none.
+    void record(const char* name, const char* category,
+                Clock::time_point begin, Clock::time_point end,
+                const char* detail = nullptr, int id = -1);
+
+    // Events currently held, and events overwritten since start()
+    std::size_t getEventCount() const { return kept.size() + count; }
+    std::size_t getDroppedCount() const { return dropped; }
+
+    // Writes the kept events, then the ring oldest first, as trace-event JSON
+    void writeJson(std::ostream& out) const;
+    // Writes writeJson() output to a file; throws if it cannot be opened
+    void dump(const std::string& path) const;
+
+private:
+    struct Event {
+        const char* name;
+        const char* category;
+        std::int64_t beginNs;      // Since start()
+        std::int64_t durationNs;
+        std::int32_t id;
+        char detail[DETAIL_SIZE];
+    };
+
+    TraceRecorder() = default;
+
+    // Categories whose events go to the kept buffer rather than the ring
+    static bool isKeptCategory(const char* category);
+
+    bool enabled = false;
+    Clock::time_point origin;
+    std::vector<Event> kept;
+    std::vector<Event> ring;
+    std::size_t next = 0;
+    std::size_t count = 0;
+    std::size_t dropped = 0;
+};
+
+// Records the enclosing block as one trace event while recording is on
+class TraceScope {
+public:
+    explicit TraceScope(const char* name, const char* category,
+                        const char* detail = nullptr, int id = -1)
+        : name(name)
+        , category(category)
+        , detail(detail)
+        , id(id)
+        , active(TraceRecorder::instance().isEnabled())
+    {
+        if (active) begin = TraceRecorder::Clock::now();
+    }
+    ~TraceScope() {
+        if (active) {
+            TraceRecorder::instance().record(name, category, begin, TraceRecorder::Clock::now(), detail, id);
+        }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    const char* category;
+    const char* detail;
+    int id;
+    bool active;
+    TraceRecorder::Clock::time_point begin;
+};
+
+#endif // TRACERECORDER_HPP
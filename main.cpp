@@ -16,14 +16,20 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include "GameWorld.hpp"
 #include "MapGenerator.h"
-#include "Critter.hpp"
+#include "CritterStore.hpp"
 #include "CritterSpawner.hpp"
 #include "TowerManager.hpp"
 #include "TowerShop.hpp"
+#include "TextureCache.hpp"
 #include "TowerObserver.hpp"
 #include "CritterObserver.hpp"
 #include "MapObserver.hpp"
+#include "FrameProfiler.hpp"
+#include "PerfHud.hpp"
+#include "TraceRecorder.hpp"
+#include "CounterRegistry.hpp"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -93,16 +99,38 @@ void signalHandler(int signum)
     raise(signum);
 }
 
+// Logs a finished wave's frame and step time percentiles, and appends them
+// as one JSON line to wave_timings.jsonl for comparing releases
+void reportWaveTimings(const WaveTimings &timings, const char *outcome)
+{
+    writeWaveTimingsSummary(std::cout, timings);
+    std::cout << std::endl;
+
+    std::ofstream timingsFile("wave_timings.jsonl", std::ios_base::app);
+    if (!timingsFile.is_open())
+    {
+        logError("Could not write wave_timings.jsonl");
+        return;
+    }
+    writeWaveTimingsJson(timingsFile, timings, outcome);
+    timingsFile << '\n';
+}
+
 // Allows user to choose with a UI between preset maps or custom map creation.
 int showLevelSelectionScreen()
 {
+    TraceRecorder::Clock::time_point windowStart = TraceRecorder::Clock::now();
     sf::RenderWindow levelWindow(sf::VideoMode({400, 300}), "Tower Defense - Level Selection");
+    TraceRecorder::instance().record("window creation", "startup", windowStart, TraceRecorder::Clock::now(), "level selection");
 
     // Load font
     sf::Font font;
-    if (!font.openFromFile("fonts/arial.ttf"))
     {
-        throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+        TraceScope fontTrace("font load", "io", "fonts/arial.ttf");
+        if (!font.openFromFile("fonts/arial.ttf"))
+        {
+            throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+        }
     }
 
     // Create title text
@@ -254,12 +282,17 @@ int showLevelSelectionScreen()
 // Custom Map Dimensions
 std::pair<int, int> getCustomMapDimensions()
 {
+    TraceRecorder::Clock::time_point windowStart = TraceRecorder::Clock::now();
     sf::RenderWindow dimWindow(sf::VideoMode({400, 200}), "Enter Map Dimensions");
+    TraceRecorder::instance().record("window creation", "startup", windowStart, TraceRecorder::Clock::now(), "map dimensions");
 
     sf::Font font;
-    if (!font.openFromFile("fonts/arial.ttf"))
     {
-        throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+        TraceScope fontTrace("font load", "io", "fonts/arial.ttf");
+        if (!font.openFromFile("fonts/arial.ttf"))
+        {
+            throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+        }
     }
 
     // Title text
@@ -556,6 +589,20 @@ int main()
 
         std::cout << "Initializing Tower Defense Game..." << std::endl;
 
+        // Record startup and frame scopes; F4 or exit writes them to TRACE_FILE
+        const std::string TRACE_FILE = "game_trace.json";
+        TraceRecorder& tracer = TraceRecorder::instance();
+        tracer.start();
+        auto saveTrace = [&]() {
+            try {
+                tracer.dump(TRACE_FILE);
+                std::cout << "Trace written to " << TRACE_FILE << " ("
+                          << tracer.getEventCount() << " events)" << std::endl;
+            } catch (const std::exception &e) {
+                logError(e.what());
+            }
+        };
+
         // Show level selection screen first
         int selectedLevel = showLevelSelectionScreen();
 
@@ -569,27 +616,42 @@ int main()
         }
 
         // Create a separate window for the map editor (or reuse an existing one)
+        TraceRecorder::Clock::time_point windowStart = TraceRecorder::Clock::now();
         sf::RenderWindow mapEditorWindow(sf::VideoMode({800, 600}), "Map Editor");
+        tracer.record("window creation", "startup", windowStart, TraceRecorder::Clock::now(), "map editor");
 
-        // Pass both level and dimensions to MapGenerator
-        MapGenerator mapGen(selectedLevel, mapWidth, mapHeight);
-        mapGen.builder(&mapEditorWindow);
-        std::vector<sf::Vector2f> waypoints = mapGen.getWaypoints();
-        // Check if waypoints are valid
-        if (waypoints.empty())
+        // Pass both level and dimensions to the simulation; it builds the map
+        // (running the editor for custom levels) and the critter path
+        GameWorld world(selectedLevel, mapWidth, mapHeight);
         {
-            throw std::runtime_error("ERROR: No waypoints generated! Exiting game.");
+            TraceScope trace("map build", "startup");
+            world.build(&mapEditorWindow);
         }
 
+        MapGenerator& mapGen = world.getMap();
+        CritterSpawner& spawner = world.getSpawner();
+        TowerManager& towerManager = world.getTowerManager();
+
         // Create SFML Window
         sf::Vector2u windowSize = mapGen.getRequiredWindowSize();
+        windowStart = TraceRecorder::Clock::now();
         sf::RenderWindow window(sf::VideoMode(windowSize), "Tower Defense");
-
-        // Create critter spawner
-        CritterSpawner spawner(waypoints);
-
-        // Create tower manager and shop
-        TowerManager towerManager(mapGen, spawner);
+        tracer.record("window creation", "startup", windowStart, TraceRecorder::Clock::now(), "game");
+
+        // Decode every game texture once up front so no PNG is loaded mid-wave
+        TextureCache& textureCache = TextureCache::instance();
+        TraceRecorder::Clock::time_point preloadStart = TraceRecorder::Clock::now();
+        textureCache.preload({
+            "textures/critter.png", "textures/critter2.png", "textures/critter3.png",
+            "textures/stage_1.png", "textures/stage_2.png", "textures/stage_3.png",
+            "textures/area1.png", "textures/area2.png", "textures/area3.png",
+            "textures/special1.png", "textures/special2.png", "textures/special3.png",
+            "textures/dirt_path_top.png", "textures/grass_block_top.png",
+            "textures/emerald_block.png", "textures/bricks.png", "textures/hpicon.png"
+        });
+        tracer.record("texture preload", "startup", preloadStart, TraceRecorder::Clock::now());
+
+        // Create shop
         TowerShop shop(towerManager, window);
     
         // Create Observers for MapGenerator, TowerManager, CritterSpawner
@@ -599,9 +661,12 @@ int main()
 
         // Load font
         sf::Font font;
-        if (!font.openFromFile("fonts/arial.ttf"))
         {
-            throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+            TraceScope fontTrace("font load", "io", "fonts/arial.ttf");
+            if (!font.openFromFile("fonts/arial.ttf"))
+            {
+                throw std::runtime_error("Error loading font: 'fonts/arial.ttf'");
+            }
         }
 
        
@@ -665,7 +730,7 @@ int main()
 
         // Help dialog
         bool showHelpDialog = false;
-        sf::RectangleShape helpDialog(sf::Vector2f(400.f, 350.f));
+        sf::RectangleShape helpDialog(sf::Vector2f(400.f, 470.f));
         helpDialog.setFillColor(sf::Color(50, 50, 50, 230));
         helpDialog.setOutlineColor(sf::Color::White);
         helpDialog.setOutlineThickness(2.f);
@@ -687,6 +752,9 @@ int main()
             "Alt + Mouse Over: Inspect object\n\n"
             "Shop: Buy new towers\n\n"
             "Start Wave: Begin next enemy wave\n\n"
+            "F3: Performance overlay\n\n"
+            "F4: Save performance trace\n\n"
+            "F5: Save hot path counters\n\n"
             "R: Restart (Once prompted)"
         );
         helpDialogContent.setCharacterSize(16);
@@ -856,14 +924,8 @@ int main()
 
 
         // Add heart icon for lives 
-        sf::Texture heartTexture;
-        sf::Sprite heartSprite(heartTexture);
-
-        // Load the heart texture
-        if (!heartTexture.loadFromFile("textures/hpicon.png")) {
-            throw std::runtime_error("Error loading heart icon: 'textures/hpicon.png'");
-        }
-        heartSprite = sf::Sprite(heartTexture);  // Create the sprite with the texture
+        TextureCache::Handle heartTexture = textureCache.acquire("textures/hpicon.png");
+        sf::Sprite heartSprite(*heartTexture);  // Create the sprite with the texture
         heartSprite.setScale(sf::Vector2f(0.5f, 0.5f)); // Adjust scale as needed
         heartSprite.setPosition(sf::Vector2f(10.f, 40.f));  // Position left of the lives text
 
@@ -903,21 +965,62 @@ int main()
     
        
 
+        // Frame timing overlay, toggled with F3
+        PerfHud perfHud(font);
+        FrameProfiler& profiler = FrameProfiler::instance();
+
+        // Draws a UI element and counts it for the performance overlay
+        auto drawUi = [&](const sf::Drawable& drawable) {
+            window.draw(drawable);
+            profiler.countDrawCalls();
+        };
+
+        // Texture decodes seen since the current wave started (should stay at zero)
+        bool waveWasRunning = false;
+        std::size_t decodesAtWaveStart = 0;
+
         // Game loop
         while (window.isOpen())
         {
             try
             {
+                TraceScope frameTrace("frame", "frame");
                 float deltaTime = clock.restart().asSeconds();
+                profiler.beginFrame();
 
                 // Process window events
                 if (const auto event = window.pollEvent())
                 {
+                    FrameProfiler::Scope inputScope(FramePhase::INPUT);
+
                     if (event->is<sf::Event::Closed>())
                     {
                         std::cout << "Window closing..." << std::endl;
                         window.close();
                     }
+                    // Toggle the performance overlay
+                    else if (event->is<sf::Event::KeyPressed>() &&
+                             event->getIf<sf::Event::KeyPressed>()->code == sf::Keyboard::Key::F3)
+                    {
+                        perfHud.toggle();
+                    }
+                    // Write the recent trace events for a trace viewer
+                    else if (event->is<sf::Event::KeyPressed>() &&
+                             event->getIf<sf::Event::KeyPressed>()->code == sf::Keyboard::Key::F4)
+                    {
+                        saveTrace();
+                    }
+                    // Write the hot path counter totals
+                    else if (event->is<sf::Event::KeyPressed>() &&
+                             event->getIf<sf::Event::KeyPressed>()->code == sf::Keyboard::Key::F5)
+                    {
+                        try {
+                            CounterRegistry::instance().dump("game_counters.json");
+                            std::cout << "Counters written to game_counters.json" << std::endl;
+                        } catch (const std::exception &e) {
+                            logError(e.what());
+                        }
+                    }
                     // Add game restart logic
                     else if (spawner.isGameOver() && event->is<sf::Event::KeyPressed>())
                     {
@@ -925,8 +1028,7 @@ int main()
                         {
                             if (keyEvent->code == sf::Keyboard::Key::R) {
                                 // Reset the game
-                                spawner.reset();
-                                towerManager.reset();
+                                world.reset();
                                 shop.reset();
                             }
                         }
@@ -938,8 +1040,7 @@ int main()
                         {
                             if (keyEvent->code == sf::Keyboard::Key::R) {
                                 // Reset the game
-                                spawner.reset();
-                                towerManager.reset();
+                                world.reset();
                                 shop.reset();
                             }
                         }
@@ -1065,6 +1166,7 @@ int main()
                             if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LAlt) ||
                                 sf::Keyboard::isKeyPressed(sf::Keyboard::Key::RAlt))
                             {
+                                FrameProfiler::Scope tooltipScope(FramePhase::TOOLTIPS);
 
                                 // First check for tower under mouse
                                 Tower *hoveredTower = towerManager.getTowerUnderMouse(worldPos);
@@ -1186,28 +1288,22 @@ int main()
                                 else
                                 {
                                     // Only if no tower was found, check for critter
-                                    Critter *hoveredCritter = spawner.getCritterUnderMouse(worldPos);
+                                    const CritterStore &critters = spawner.getCritters();
+                                    int hoveredCritter = critters.resolve(spawner.getCritterUnderMouse(worldPos));
 
-                                    if (hoveredCritter)
+                                    if (hoveredCritter >= 0)
                                     {
+
                                         // Format the critter information as a string
                                         std::string tooltipString = "Critter Info:\n";
 
-                                        // Add type info based on texture path
-                                        std::string type = "Normal";
-                                        if (hoveredCritter->getTexturePath() == "textures/critter2.png")
-                                        {
-                                            type = "Medium";
-                                        }
-                                        else if (hoveredCritter->getTexturePath() == "textures/critter3.png")
-                                        {
-                                            type = "Strong";
-                                        }
+                                        // Add type info from the critter type table
+                                        const CritterTypeInfo& type = CritterTypeRegistry::instance().get(critters.getTypeId(hoveredCritter));
 
-                                        tooltipString += "Type: " + type + "\n";
-                                        tooltipString += "Health: " + std::to_string(static_cast<int>(hoveredCritter->getHealth())) + "\n";
-                                        tooltipString += "Speed: " + std::to_string(static_cast<int>(hoveredCritter->getSpeed())) + "\n";
-                                        tooltipString += "Reward: $" + std::to_string(hoveredCritter->getReward()) + "\n";
+                                        tooltipString += "Type: " + type.name + "\n";
+                                        tooltipString += "Health: " + std::to_string(static_cast<int>(critters.getHealth(hoveredCritter))) + "\n";
+                                        tooltipString += "Speed: " + std::to_string(static_cast<int>(critters.getSpeed(hoveredCritter))) + "\n";
+                                        tooltipString += "Reward: $" + std::to_string(critters.getReward(hoveredCritter)) + "\n";
 
                                         
                                         // Position tooltip near mouse but not under it
@@ -1264,11 +1360,20 @@ int main()
                     }
                 }
 
-                // Update game state
-                if (!spawner.isGameOver()) {
-                    spawner.update(deltaTime);
-                    towerManager.update(deltaTime);
-                } // Close the condition here
+                // Update game state in fixed steps; rendering blends between them
+                world.advance(deltaTime);
+
+                // Report how many textures were decoded during each wave
+                bool waveRunning = !spawner.isWaveComplete();
+                if (waveRunning && !waveWasRunning) {
+                    decodesAtWaveStart = textureCache.getMissCount();
+                } else if (!waveRunning && waveWasRunning) {
+                    std::cout << "Wave finished: "
+                              << (textureCache.getMissCount() - decodesAtWaveStart) << " texture decodes, "
+                              << textureCache.getHitCount() << " cache hits total" << std::endl;
+                    reportWaveTimings(world.getWaveTimings(), spawner.isGameOver() ? "game over" : "complete");
+                }
+                waveWasRunning = waveRunning;
 
                 // Update texts
                 waveText.setString("Wave: " + std::to_string(spawner.getCurrentWave()));
@@ -1285,111 +1390,135 @@ int main()
                     10.f                                      // 10px from top
                     ));
 
+                perfHud.update(world, deltaTime);
+
                 // Render everything
                 window.clear(sf::Color::Black);
-                mObs.update();
-                tObs.update();
-                cObs.update();
+                {
+                    FrameProfiler::Scope scope(FramePhase::MAP_DRAW);
+                    mObs.render();
+                }
+                {
+                    FrameProfiler::Scope scope(FramePhase::TOWER_DRAW);
+                    tObs.render();
+                }
+                {
+                    FrameProfiler::Scope scope(FramePhase::CRITTER_DRAW);
+                    cObs.render();
+                }
                 // mapGen.draw(window);
                 // spawner.draw(window);
                 // towerManager.draw(window);
 
                 // Draw UI elements
-                window.draw(waveText);
-                window.draw(currencyText);
-                // Draw heart icon and lives counter
-                window.draw(heartSprite);
-                window.draw(livesText);
+                {
+                    FrameProfiler::Scope uiScope(FramePhase::UI_DRAW);
+                    drawUi(waveText);
+                    drawUi(currencyText);
+                    // Draw heart icon and lives counter
+                    drawUi(heartSprite);
+                    drawUi(livesText);
 
 
-                // Draw button only if we can start a new wave
-                if (spawner.canStartNewWave())
-                {
-                    window.draw(startButton);
-                    window.draw(buttonText);
-                }
+                    // Draw button only if we can start a new wave
+                    if (spawner.canStartNewWave())
+                    {
+                        drawUi(startButton);
+                        drawUi(buttonText);
+                    }
 
-                // Draw shop last so it appears on top
-                shop.draw(window);
+                    // Draw shop last so it appears on top
+                    {
+                        FrameProfiler::Scope shopScope(FramePhase::SHOP_DRAW);
+                        shop.draw(window);
+                    }
 
-                // Draw critter tooltip if active
-                if (showCritterTooltip)
-                {
-                    window.draw(tooltipBackground);
-                    window.draw(critterTooltipText);
-                }
+                    // Draw critter tooltip if active
+                    if (showCritterTooltip)
+                    {
+                        drawUi(tooltipBackground);
+                        drawUi(critterTooltipText);
+                    }
 
-                // Draw tower tooltip if active
-                if (showTowerTooltip)
-                {
-                    window.draw(towerTooltipBackground);
-                    window.draw(towerTooltipText);
-                }
-                // Draw help button
-                window.draw(helpButton);
-                window.draw(helpButtonText);
+                    // Draw tower tooltip if active
+                    if (showTowerTooltip)
+                    {
+                        drawUi(towerTooltipBackground);
+                        drawUi(towerTooltipText);
+                    }
+                    // Draw help button
+                    drawUi(helpButton);
+                    drawUi(helpButtonText);
                 
-                // Draw help dialog if active
-                if (showHelpDialog) {
-                    // Add semi-transparent overlay
-                    sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
-                    overlay.setFillColor(sf::Color(0, 0, 0, 150)); // Semi-transparent black
-                    window.draw(overlay);
+                    // Draw help dialog if active
+                    if (showHelpDialog) {
+                        // Add semi-transparent overlay
+                        sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
+                        overlay.setFillColor(sf::Color(0, 0, 0, 150)); // Semi-transparent black
+                        drawUi(overlay);
                     
-                    // Draw help dialog and contents
-                    window.draw(helpDialog);
-                    window.draw(helpDialogTitle);
-                    window.draw(helpDialogContent);
-                    window.draw(helpCloseButton);
-                    window.draw(helpCloseButtonText);
-                }
-                if (spawner.isGameOver()) {
-                    // Add semi-transparent overlay
-                    sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
-                    overlay.setFillColor(sf::Color(0, 0, 0, 180)); // Semi-transparent black
-                    window.draw(overlay);
+                        // Draw help dialog and contents
+                        drawUi(helpDialog);
+                        drawUi(helpDialogTitle);
+                        drawUi(helpDialogContent);
+                        drawUi(helpCloseButton);
+                        drawUi(helpCloseButtonText);
+                    }
+                    if (spawner.isGameOver()) {
+                        // Add semi-transparent overlay
+                        sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
+                        overlay.setFillColor(sf::Color(0, 0, 0, 180)); // Semi-transparent black
+                        drawUi(overlay);
                     
-                    // Position and draw game over text
-                    sf::FloatRect gameOverBounds = gameOverText.getLocalBounds();
-                    gameOverText.setPosition(sf::Vector2f(
-                        (windowSize.x - gameOverBounds.size.x) / 2.f,
-                        (windowSize.y - gameOverBounds.size.y) / 2.f - 50.f
-                    ));
-                    window.draw(gameOverText);
+                        // Position and draw game over text
+                        sf::FloatRect gameOverBounds = gameOverText.getLocalBounds();
+                        gameOverText.setPosition(sf::Vector2f(
+                            (windowSize.x - gameOverBounds.size.x) / 2.f,
+                            (windowSize.y - gameOverBounds.size.y) / 2.f - 50.f
+                        ));
+                        drawUi(gameOverText);
                     
-                    // Position and draw restart text
-                    sf::FloatRect restartBounds = restartText.getLocalBounds();
-                    restartText.setPosition(sf::Vector2f(
-                        (windowSize.x - restartBounds.size.x) / 2.f,
-                        gameOverText.getPosition().y + gameOverBounds.size.y + 30.f
-                    ));
-                    window.draw(restartText);
-                }
-                // Check for victory condition and draw victory screen
-                if (spawner.isGameComplete()) {
-                    // Add semi-transparent overlay
-                    sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
-                    overlay.setFillColor(sf::Color(0, 0, 0, 180)); // Semi-transparent black
-                    window.draw(overlay);
+                        // Position and draw restart text
+                        sf::FloatRect restartBounds = restartText.getLocalBounds();
+                        restartText.setPosition(sf::Vector2f(
+                            (windowSize.x - restartBounds.size.x) / 2.f,
+                            gameOverText.getPosition().y + gameOverBounds.size.y + 30.f
+                        ));
+                        drawUi(restartText);
+                    }
+                    // Check for victory condition and draw victory screen
+                    if (spawner.isGameComplete()) {
+                        // Add semi-transparent overlay
+                        sf::RectangleShape overlay(sf::Vector2f(windowSize.x, windowSize.y));
+                        overlay.setFillColor(sf::Color(0, 0, 0, 180)); // Semi-transparent black
+                        drawUi(overlay);
                     
-                    // Position and draw victory text
-                    sf::FloatRect victoryBounds = victoryText.getLocalBounds();
-                    victoryText.setPosition(sf::Vector2f(
-                        (windowSize.x - victoryBounds.size.x) / 2.f,
-                        (windowSize.y - victoryBounds.size.y) / 2.f - 50.f
-                    ));
-                    window.draw(victoryText);
+                        // Position and draw victory text
+                        sf::FloatRect victoryBounds = victoryText.getLocalBounds();
+                        victoryText.setPosition(sf::Vector2f(
+                            (windowSize.x - victoryBounds.size.x) / 2.f,
+                            (windowSize.y - victoryBounds.size.y) / 2.f - 50.f
+                        ));
+                        drawUi(victoryText);
                     
-                    // Position and draw restart text
-                    sf::FloatRect victoryRestartBounds = victoryRestartText.getLocalBounds();
-                    victoryRestartText.setPosition(sf::Vector2f(
-                        (windowSize.x - victoryRestartBounds.size.x) / 2.f,
-                        victoryText.getPosition().y + victoryBounds.size.y + 30.f
-                    ));
-                    window.draw(victoryRestartText);
+                        // Position and draw restart text
+                        sf::FloatRect victoryRestartBounds = victoryRestartText.getLocalBounds();
+                        victoryRestartText.setPosition(sf::Vector2f(
+                            (windowSize.x - victoryRestartBounds.size.x) / 2.f,
+                            victoryText.getPosition().y + victoryBounds.size.y + 30.f
+                        ));
+                        drawUi(victoryRestartText);
+                    }
                 }
 
-                window.display();
+                // Overlay goes above everything else
+                perfHud.draw(window);
+
+                {
+                    FrameProfiler::Scope displayScope(FramePhase::DISPLAY);
+                    window.display();
+                }
+                profiler.endFrame();
             }
             catch (const std::exception &e)
             {
@@ -1404,6 +1533,8 @@ int main()
             }
         }
 
+        // Keep the last stretch of play for inspection after the window closes
+        saveTrace();
         return 0;
     }
     catch (const std::exception &e)
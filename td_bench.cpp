@@ -0,0 +1,501 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * td_bench.cpp - Headless stress benchmark
+ *
+ * Purpose: Builds a preset or synthetic map, places a tower layout, keeps N
+ * critters on the path and runs the simulation step for K ticks without a
+ * window. Reports ticks per second, nanoseconds per critter-tower pair
+ * scored (and over all pairs), and peak memory, in total and per subsystem, for sizing hardware and catching
+ * regressions. With --assert-no-alloc it also plays the game's waves, and
+ * its global operator new and delete fail the run if a step after warm-up
+ * touches the heap.
+ *
+ * Dependencies: GameWorld, CritterTypeRegistry, RangeKernel, CounterRegistry, MemoryTracker, BenchSupport, chrono, random, execinfo and dlfcn where available
+ */
+/**
+ * @file td_bench.cpp
+ * @brief Command line driver for the headless simulation benchmark
+ */
+
+#include "GameWorld.hpp"
+#include "CritterTypeRegistry.hpp"
+#include "RangeKernel.hpp"
+#include "CounterRegistry.hpp"
+#include "MemoryTracker.hpp"
+#include "BenchSupport.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#define TD_BENCH_BACKTRACE
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+// Heap use inside checked steps, for --assert-no-alloc. The global
+// operator new and delete below report here while the check is armed.
+// The bench steps the world on one thread, so the table takes no lock.
+namespace alloccheck {
+
+constexpr int MAX_FRAMES = 16;
+constexpr std::size_t MAX_SITES = 64;
+// Frames printed per call site, after skipping the allocator's own
+constexpr int REPORTED_FRAMES = 3;
+
+// Allocations, or frees, made from the same call stack
+struct Site {
+    void* frames[MAX_FRAMES];
+    int depth;
+    bool release;
+    std::uint64_t count;
+    std::uint64_t bytes;
+};
+
+std::atomic<bool> armed{false};
+// Set while recording, so the backtrace's own allocations are not counted
+thread_local bool recording = false;
+
+Site sites[MAX_SITES];
+std::size_t siteCount = 0;
+std::uint64_t allocations = 0;
+std::uint64_t allocatedBytes = 0;
+std::uint64_t releases = 0;
+
+void record(std::size_t bytes, bool release) {
+    if (!armed.load(std::memory_order_relaxed) || recording) return;
+    recording = true;
+
+    if (release) {
+        ++releases;
+    } else {
+        ++allocations;
+        allocatedBytes += bytes;
+    }
+
+    void* frames[MAX_FRAMES];
+    int depth = 0;
+#ifdef TD_BENCH_BACKTRACE
+    depth = backtrace(frames, MAX_FRAMES);
+#endif
+
+    Site* site = nullptr;
+    for (std::size_t i = 0; i < siteCount && !site; ++i) {
+        if (sites[i].release == release && sites[i].depth == depth &&
+            std::memcmp(sites[i].frames, frames, sizeof(void*) * depth) == 0) {
+            site = &sites[i];
+        }
+    }
+    if (!site && siteCount < MAX_SITES) {
+        site = &sites[siteCount++];
+        std::memcpy(site->frames, frames, sizeof(void*) * depth);
+        site->depth = depth;
+        site->release = release;
+        site->count = 0;
+        site->bytes = 0;
+    }
+    if (site) {
+        ++site->count;
+        site->bytes += bytes;
+    }
+
+    recording = false;
+}
+
+void arm() {
+#ifdef TD_BENCH_BACKTRACE
+    // The first backtrace loads the unwinder, which allocates
+    static bool unwinderLoaded = false;
+    if (!unwinderLoaded) {
+        void* frames[1];
+        backtrace(frames, 1);
+        unwinderLoaded = true;
+    }
+#endif
+    armed.store(true, std::memory_order_relaxed);
+}
+
+void disarm() {
+    armed.store(false, std::memory_order_relaxed);
+}
+
+bool clean() {
+    return allocations == 0 && releases == 0;
+}
+
+#ifdef TD_BENCH_BACKTRACE
+// Function name for a return address, or the module and offset to pass to
+// addr2line when the symbol is not exported
+std::string describe(void* address) {
+    std::ostringstream out;
+    Dl_info info{};
+    bool found = dladdr(address, &info) != 0;
+    if (found && info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        std::string name = status == 0 ? demangled : info.dli_sname;
+        std::free(demangled);
+        out << name.substr(0, name.find('('));
+    } else if (found && info.dli_fname) {
+        out << info.dli_fname << "+0x" << std::hex
+            << static_cast<const char*>(address) - static_cast<const char*>(info.dli_fbase);
+    } else {
+        out << address;
+    }
+    return out.str();
+}
+
+// Frames inside this file's hooks and the standard allocators say nothing
+// about which game code asked for the memory
+bool isAllocatorFrame(const std::string& name) {
+    for (const char* prefix : {"alloccheck::", "operator new", "operator delete", "std::",
+                               "__gnu_cxx::", "TrackingAllocator", "void std::"}) {
+        if (name.compare(0, std::strlen(prefix), prefix) == 0) return true;
+    }
+    return false;
+}
+#endif
+
+void report(std::ostream& out) {
+    for (std::size_t i = 0; i < siteCount; ++i) {
+        const Site& site = sites[i];
+        out << "  " << site.count << (site.release ? " frees" : " allocations");
+        if (!site.release) {
+            out << " (" << site.bytes << " bytes)";
+        }
+#ifdef TD_BENCH_BACKTRACE
+        const char* separator = " at ";
+        int shown = 0;
+        for (int frame = 0; frame < site.depth && shown < REPORTED_FRAMES; ++frame) {
+            std::string name = describe(site.frames[frame]);
+            if (shown == 0 && isAllocatorFrame(name)) continue;
+            out << separator << name;
+            separator = " <- ";
+            ++shown;
+        }
+#else
+        out << " (no call stacks on this platform)";
+#endif
+        out << "\n";
+    }
+    if (siteCount == MAX_SITES) {
+        out << "  (only the first " << MAX_SITES << " call sites are listed)\n";
+    }
+}
+
+} // namespace alloccheck
+
+// Standard new[], nothrow new and the array deletes all forward to these,
+// so they see every allocation that is not over-aligned
+void* operator new(std::size_t size) {
+    alloccheck::record(size, false);
+    for (;;) {
+        if (void* block = std::malloc(size ? size : 1)) {
+            return block;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void* block) noexcept {
+    if (block) {
+        alloccheck::record(0, true);
+    }
+    std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept {
+    operator delete(block);
+}
+
+namespace {
+
+// Lives and gold are topped up to these every tick so leaks never end the run
+constexpr int BENCH_LIVES = 1000000000;
+constexpr int BENCH_GOLD = 1000000000;
+// Longest run of wave steps played by --assert-no-alloc (15 minutes)
+constexpr int MAX_WAVE_TICKS = 15 * 60 * 120;
+
+enum class TowerLayout { PATH, GRID };
+
+struct BenchConfig {
+    bench::MapChoice map;
+    int critters = 1000;
+    int ticks = 1200;
+    int warmupTicks = 120;
+    int towers = 20;
+    TowerLayout layout = TowerLayout::PATH;
+    int towerType = -1;      // 0 basic, 1 area, 2 special, -1 cycles through all three
+    int towerLevel = 1;
+    unsigned seed = 1;
+    std::string countersFile;  // Written only if set
+    bool assertNoAlloc = false;
+};
+
+void printUsage() {
+    std::cout <<
+        "Usage: td_bench [options]\n"
+        "  --map easy|normal|hard|WxH   Preset level or synthetic WxH serpentine map (default easy)\n"
+        "  --critters N                 Critters kept on the path (default 1000)\n"
+        "  --ticks K                    Timed simulation ticks (default 1200)\n"
+        "  --warmup W                   Untimed ticks before measuring (default 120)\n"
+        "  --towers T                   Towers to place, spread over the layout (default 20)\n"
+        "  --layout path|grid           Tiles next to the path, or any free tile (default path)\n"
+        "  --tower-type basic|area|special|mixed  (default mixed)\n"
+        "  --tower-level 1..3           Upgrade every tower to this level (default 1)\n"
+        "  --seed S                     Seed for critter placement (default 1)\n"
+        "  --counters FILE              Write the timed ticks' hot path counters as JSON\n"
+        "  --assert-no-alloc            Also play every wave on a fresh world. Exit with status 2\n"
+        "                               if a step after warm-up allocates or frees heap memory,\n"
+        "                               listing the call sites\n";
+}
+
+BenchConfig parseArgs(int argc, char** argv) {
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            std::exit(0);
+        }
+        if (option == "--assert-no-alloc") {
+            config.assertNoAlloc = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::runtime_error("Missing value for " + option);
+        }
+        std::string value = argv[++i];
+
+        if (option == "--map") {
+            config.map = bench::parseMap(value);
+        } else if (option == "--critters") {
+            config.critters = bench::parseInt(option, value, 0);
+        } else if (option == "--ticks") {
+            config.ticks = bench::parseInt(option, value, 1);
+        } else if (option == "--warmup") {
+            config.warmupTicks = bench::parseInt(option, value, 0);
+        } else if (option == "--towers") {
+            config.towers = bench::parseInt(option, value, 0);
+        } else if (option == "--layout") {
+            if (value == "path") {
+                config.layout = TowerLayout::PATH;
+            } else if (value == "grid") {
+                config.layout = TowerLayout::GRID;
+            } else {
+                throw std::runtime_error("Unknown layout: " + value);
+            }
+        } else if (option == "--tower-type") {
+            if (value == "basic") {
+                config.towerType = 0;
+            } else if (value == "area") {
+                config.towerType = 1;
+            } else if (value == "special") {
+                config.towerType = 2;
+            } else if (value == "mixed") {
+                config.towerType = -1;
+            } else {
+                throw std::runtime_error("Unknown tower type: " + value);
+            }
+        } else if (option == "--tower-level") {
+            config.towerLevel = bench::parseInt(option, value, 1);
+            if (config.towerLevel > 3) {
+                throw std::runtime_error("Tower level must be 1 to 3");
+            }
+        } else if (option == "--seed") {
+            config.seed = static_cast<unsigned>(bench::parseInt(option, value, 0));
+        } else if (option == "--counters") {
+            config.countersFile = value;
+        } else {
+            throw std::runtime_error("Unknown option: " + option);
+        }
+    }
+    return config;
+}
+
+// Places up to config.towers towers spread evenly over the layout's candidate tiles
+void placeTowers(GameWorld& world, const BenchConfig& config) {
+    std::vector<sf::Vector2i> candidates =
+        bench::towerSpots(world.getMap().getMap(), config.layout == TowerLayout::PATH);
+
+    TowerManager& towerManager = world.getTowerManager();
+    std::size_t wanted = std::min(candidates.size(), static_cast<std::size_t>(config.towers));
+    for (std::size_t i = 0; i < wanted; ++i) {
+        sf::Vector2f position = bench::tileCenter(candidates[i * candidates.size() / wanted]);
+        int type = config.towerType >= 0 ? config.towerType : static_cast<int>(i % 3);
+        if (!towerManager.tryPlaceTower(position, type)) continue;
+        for (int level = 1; level < config.towerLevel; ++level) {
+            towerManager.tryUpgradeTower(position);
+        }
+    }
+}
+
+// Spawns critters at random path positions until config.critters are alive,
+// cycling through the registered critter types
+void refillCritters(GameWorld& world, const BenchConfig& config, std::mt19937& rng, std::uint32_t& spawned) {
+    CritterSpawner& spawner = world.getSpawner();
+    const CritterTypeRegistry& types = CritterTypeRegistry::instance();
+    std::uniform_real_distribution<float> along(0.0f, world.getPathLengths().back());
+
+    while (spawner.getCritters().size() < static_cast<std::size_t>(config.critters)) {
+        CritterTypeId id = static_cast<CritterTypeId>(spawned++ % types.getTypeCount());
+        CritterSpawner::CritterType type{id, 100.0f, types.get(id).maxHealth, 0};
+        spawner.spawnOnPath(type, along(rng));
+    }
+}
+
+void topUpEconomy(CritterSpawner& spawner) {
+    spawner.adjustLifePoints(BENCH_LIVES - spawner.getLifePoints());
+    spawner.adjustPlayerCurrency(BENCH_GOLD - spawner.getPlayerCurrency());
+}
+
+// Plays the spawner's own waves on a fresh world with the same towers, as
+// the game does, for --assert-no-alloc. Steps after the first
+// config.warmupTicks are checked. Returns the number of steps taken.
+int playWaves(const BenchConfig& config) {
+    GameWorld world(config.map.level, config.map.width, config.map.height);
+    world.build();
+    CritterSpawner& spawner = world.getSpawner();
+    topUpEconomy(spawner);
+    placeTowers(world, config);
+
+    int tick = 0;
+    while (spawner.canStartNewWave()) {
+        spawner.startNextWave();
+        do {
+            topUpEconomy(spawner);
+            if (tick >= config.warmupTicks) alloccheck::arm();
+            world.step(GameWorld::FIXED_TIMESTEP);
+            alloccheck::disarm();
+            ++tick;
+        } while (!spawner.canStartNewWave() && !spawner.isGameComplete() && tick < MAX_WAVE_TICKS);
+    }
+    return tick;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        BenchConfig config = parseArgs(argc, argv);
+
+        GameWorld world(config.map.level, config.map.width, config.map.height);
+        world.build();
+        CritterSpawner& spawner = world.getSpawner();
+        topUpEconomy(spawner);
+        spawner.getCritters().reserve(static_cast<std::size_t>(config.critters));
+        spawner.getCritters().reservePathArea(world.getWaypoints());
+        placeTowers(world, config);
+
+        std::mt19937 rng(config.seed);
+        std::uint32_t spawned = 0;
+        const std::size_t towerCount = world.getTowerManager().getTowerCount();
+
+        for (int tick = 0; tick < config.warmupTicks; ++tick) {
+            refillCritters(world, config, rng, spawned);
+            topUpEconomy(spawner);
+            world.step(GameWorld::FIXED_TIMESTEP);
+        }
+
+        // Counters cover the timed ticks only
+        CounterRegistry& counters = CounterRegistry::instance();
+        counters.reset();
+
+        // Only the simulation step is timed; refilling happens between steps
+        using Clock = std::chrono::steady_clock;
+        Clock::duration elapsed{};
+        double critterTicks = 0.0;
+        for (int tick = 0; tick < config.ticks; ++tick) {
+            refillCritters(world, config, rng, spawned);
+            topUpEconomy(spawner);
+            critterTicks += static_cast<double>(spawner.getCritters().size());
+
+            if (config.assertNoAlloc) alloccheck::arm();
+            Clock::time_point start = Clock::now();
+            world.step(GameWorld::FIXED_TIMESTEP);
+            elapsed += Clock::now() - start;
+            alloccheck::disarm();
+        }
+
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        // Pairs a target scan actually scored, so maps with different
+        // densities compare; every critter against every tower is kept
+        // alongside as the all-pairs figure
+        double scoredPairs = static_cast<double>(counters.get(Counter::CRITTERS_SCANNED));
+        double allPairs = critterTicks * static_cast<double>(towerCount);
+        const TileGrid& tiles = world.getMap().getMap();
+
+        std::cout << std::fixed << std::setprecision(2)
+                  << "map            " << config.map.name << " (" << tiles.getWidth() << "x" << tiles.getHeight()
+                  << ", path " << world.getPathLengths().back() << " px)\n"
+                  << "towers         " << towerCount << "\n"
+                  << "critters       " << config.critters << "\n"
+                  << "ticks          " << config.ticks << " (+" << config.warmupTicks << " warm-up)\n"
+                  << "range kernel   " << getRangeKernelName(getRangeKernelIsa()) << "\n"
+                  << "elapsed        " << seconds * 1000.0 << " ms\n"
+                  << "ticks/sec      " << config.ticks / seconds << "\n";
+        if (scoredPairs > 0.0) {
+            std::cout << "ns/pair        " << seconds * 1e9 / scoredPairs << " (scored)\n";
+        } else {
+            std::cout << "ns/pair        n/a (no critter in range of a tower)\n";
+        }
+        if (allPairs > 0.0) {
+            std::cout << "ns/all-pairs   " << seconds * 1e9 / allPairs << "\n";
+        }
+        std::cout << "scans/tick     " << static_cast<double>(counters.get(Counter::CRITTERS_SCANNED)) / config.ticks << "\n"
+                  << "checks/tick    " << static_cast<double>(counters.get(Counter::DISTANCE_CHECKS)) / config.ticks << "\n";
+        std::cout << "peak memory    " << bench::peakMemoryBytes() / (1024.0 * 1024.0) << " MiB\n";
+        // Peaks cover the whole run, warm-up and tower placement included
+        for (std::size_t i = 0; i < MemoryTracker::TAG_COUNT; ++i) {
+            MemoryTag tag = static_cast<MemoryTag>(i);
+            std::cout << "  " << std::left << std::setw(13) << MemoryTracker::getName(tag) << std::right
+                      << MemoryTracker::getCurrent(tag) / 1024.0 << " KiB, peak "
+                      << MemoryTracker::getPeak(tag) / 1024.0 << " KiB\n";
+        }
+        std::cout << std::flush;
+
+        if (!config.countersFile.empty()) {
+            counters.dump(config.countersFile);
+        }
+
+        if (config.assertNoAlloc) {
+            int waveTicks = playWaves(config);
+            std::cout << "wave ticks     " << waveTicks << " (all waves, first " << config.warmupTicks
+                      << " unchecked)\n";
+            if (alloccheck::clean()) {
+                std::cout << "heap use       none after warm-up" << std::endl;
+            } else {
+                std::cout << "heap use       " << alloccheck::allocations << " allocations ("
+                          << alloccheck::allocatedBytes << " bytes) and " << alloccheck::releases
+                          << " frees after warm-up\n";
+                alloccheck::report(std::cout);
+                std::cout << std::flush;
+                return 2;
+            }
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "td_bench: " << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+}
@@ -0,0 +1,454 @@
+/**
+ * Tower Defense Game
+ * Ryan Sefrioui - Sanjai Ratnarajah
+ *
+ * td_microbench.cpp - Targeting and spatial query microbenchmarks
+ *
+ * Purpose: Times each targeting strategy's findTarget, the dynamic strategy
+ * selection, projectile splash resolution and the raw range query on their
+ * own. It sweeps critter counts, tower ranges and critter distributions
+ * along the path. Every case gets warm-up passes, then repeated timed runs
+ * whose mean, deviation and minimum are printed as a table and optionally
+ * written as JSON. Before timing, each supported range kernel is checked
+ * against a scalar loop; a mismatch exits with status 2.
+ *
+ * Dependencies: GameWorld, TargetingStrategyFactory, DynamicTargetingManager,
+ * Projectile, RangeKernel, BenchSupport, chrono, random
+ */
+/**
+ * @file td_microbench.cpp
+ * @brief Command line driver for the targeting microbenchmarks
+ */
+
+#include "GameWorld.hpp"
+#include "CritterTypeRegistry.hpp"
+#include "DynamicTargetingManager.hpp"
+#include "Projectile.hpp"
+#include "RangeKernel.hpp"
+#include "TargetingStrategyFactory.hpp"
+#include "tower.hpp"
+#include "BenchSupport.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Tower positions (and splash impacts) sampled per pass
+constexpr std::size_t SAMPLE_POSITIONS = 64;
+// Timed repetitions are batched to last at least this long
+constexpr double MIN_REP_NS = 2.0e6;
+
+enum class Distribution { UNIFORM, CLUSTERED, NEAR_EXIT };
+
+const char* distributionName(Distribution distribution) {
+    switch (distribution) {
+        case Distribution::UNIFORM: return "uniform";
+        case Distribution::CLUSTERED: return "clustered";
+        default: return "near-exit";
+    }
+}
+
+struct MicroConfig {
+    bench::MapChoice map;
+    std::vector<int> counts = {10, 100, 1000, 10000, 100000};
+    std::vector<int> ranges = {120, 150, 250};
+    std::vector<Distribution> distributions = {Distribution::UNIFORM, Distribution::CLUSTERED, Distribution::NEAR_EXIT};
+    int warmup = 2;
+    int reps = 10;
+    unsigned seed = 1;
+    std::string filter;
+    std::string jsonPath;
+};
+
+struct Result {
+    std::string name;
+    Distribution distribution;
+    int critters;
+    int radius;
+    long long opsPerRep;
+    double meanNs;
+    double stddevNs;
+    double minNs;
+    double maxNs;
+};
+
+void printUsage() {
+    std::cout <<
+        "Usage: td_microbench [options]\n"
+        "  --map easy|normal|hard|WxH   Map whose path the critters are spread along (default easy)\n"
+        "  --counts N,N,...             Critter counts (default 10,100,1000,10000,100000)\n"
+        "  --ranges R,R,...             Tower ranges / splash radii in px (default 120,150,250)\n"
+        "  --dist uniform,clustered,near-exit  Distributions along the path (default all)\n"
+        "  --warmup W                   Untimed repetitions per case (default 2)\n"
+        "  --reps R                     Timed repetitions per case (default 10)\n"
+        "  --filter TEXT                Only run benchmarks whose name contains TEXT\n"
+        "  --json FILE                  Also write the results as JSON to FILE\n"
+        "  --seed S                     Seed for critter placement (default 1)\n";
+}
+
+MicroConfig parseArgs(int argc, char** argv) {
+    MicroConfig config;
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--help" || option == "-h") {
+            printUsage();
+            std::exit(0);
+        }
+        if (i + 1 >= argc) {
+            throw std::runtime_error("Missing value for " + option);
+        }
+        std::string value = argv[++i];
+
+        if (option == "--map") {
+            config.map = bench::parseMap(value);
+        } else if (option == "--counts") {
+            config.counts = bench::parseIntList(option, value, 1);
+        } else if (option == "--ranges") {
+            config.ranges = bench::parseIntList(option, value, 1);
+        } else if (option == "--dist") {
+            config.distributions.clear();
+            std::stringstream names(value);
+            std::string name;
+            while (std::getline(names, name, ',')) {
+                if (name == "uniform") {
+                    config.distributions.push_back(Distribution::UNIFORM);
+                } else if (name == "clustered") {
+                    config.distributions.push_back(Distribution::CLUSTERED);
+                } else if (name == "near-exit") {
+                    config.distributions.push_back(Distribution::NEAR_EXIT);
+                } else {
+                    throw std::runtime_error("Unknown distribution: " + name);
+                }
+            }
+        } else if (option == "--warmup") {
+            config.warmup = bench::parseInt(option, value, 0);
+        } else if (option == "--reps") {
+            config.reps = bench::parseInt(option, value, 2);
+        } else if (option == "--filter") {
+            config.filter = value;
+        } else if (option == "--json") {
+            config.jsonPath = value;
+        } else if (option == "--seed") {
+            config.seed = static_cast<unsigned>(bench::parseInt(option, value, 0));
+        } else {
+            throw std::runtime_error("Unknown option: " + option);
+        }
+    }
+    return config;
+}
+
+// Refills the spawner with count critters placed along the path, cycling
+// through the critter types with random health, then indexes them
+void populate(GameWorld& world, Distribution distribution, int count, std::mt19937& rng) {
+    CritterSpawner& spawner = world.getSpawner();
+    spawner.reset();
+    spawner.getCritters().reserve(static_cast<std::size_t>(count));
+
+    const CritterTypeRegistry& types = CritterTypeRegistry::instance();
+    const float pathLength = world.getPathLengths().back();
+    std::uniform_real_distribution<float> uniform(0.0f, pathLength);
+    std::normal_distribution<float> cluster(pathLength * 0.5f, pathLength * 0.02f);
+    std::uniform_real_distribution<float> nearExit(pathLength * BattlefieldSummary::NEAR_EXIT_PROGRESS, pathLength);
+
+    for (int i = 0; i < count; ++i) {
+        float distance;
+        switch (distribution) {
+            case Distribution::UNIFORM: distance = uniform(rng); break;
+            case Distribution::CLUSTERED: distance = cluster(rng); break;
+            default: distance = nearExit(rng); break;
+        }
+        CritterTypeId id = static_cast<CritterTypeId>(i % types.getTypeCount());
+        std::uniform_real_distribution<float> health(1.0f, types.get(id).maxHealth);
+        spawner.spawnOnPath(CritterSpawner::CritterType{id, 100.0f, health(rng), 0}, distance);
+    }
+
+    // A zero-length step moves nobody but rebuilds the spatial index and summary
+    spawner.update(0.0f);
+}
+
+// Times op, which performs opsPerPass operations per call. Warm-up passes are
+// discarded; each timed repetition runs enough passes to last MIN_REP_NS.
+template <typename Op>
+Result measure(const std::string& name, Distribution distribution, int critters, int radius,
+               std::size_t opsPerPass, const MicroConfig& config, Op&& op)
+{
+    using Clock = std::chrono::steady_clock;
+    auto nsSince = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    };
+
+    Clock::time_point start = Clock::now();
+    op();
+    double passNs = std::max(nsSince(start), 1.0);
+    long long passes = std::max(1LL, static_cast<long long>(std::ceil(MIN_REP_NS / passNs)));
+
+    for (int rep = 0; rep < config.warmup; ++rep) {
+        for (long long p = 0; p < passes; ++p) op();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<std::size_t>(config.reps));
+    const double opsPerRep = static_cast<double>(passes) * static_cast<double>(opsPerPass);
+    for (int rep = 0; rep < config.reps; ++rep) {
+        start = Clock::now();
+        for (long long p = 0; p < passes; ++p) op();
+        samples.push_back(nsSince(start) / opsPerRep);
+    }
+
+    double mean = 0.0;
+    for (double sample : samples) mean += sample;
+    mean /= samples.size();
+    double variance = 0.0;
+    for (double sample : samples) variance += (sample - mean) * (sample - mean);
+    variance /= samples.size() - 1;
+
+    return Result{name, distribution, critters, radius, static_cast<long long>(opsPerRep), mean, std::sqrt(variance),
+                  *std::min_element(samples.begin(), samples.end()),
+                  *std::max_element(samples.begin(), samples.end())};
+}
+
+void printHeader() {
+    std::cout << std::left << std::setw(26) << "benchmark" << std::setw(11) << "dist"
+              << std::right << std::setw(8) << "critters" << std::setw(7) << "radius"
+              << std::setw(12) << "mean ns/op" << std::setw(11) << "stddev" << std::setw(8) << "cv%"
+              << std::setw(12) << "min ns/op" << "\n"
+              << std::string(95, '-') << "\n";
+}
+
+void printRow(const Result& result) {
+    double cv = result.meanNs > 0.0 ? 100.0 * result.stddevNs / result.meanNs : 0.0;
+    std::cout << std::left << std::setw(26) << result.name << std::setw(11) << distributionName(result.distribution)
+              << std::right << std::setw(8) << result.critters << std::setw(7) << result.radius
+              << std::fixed << std::setprecision(1)
+              << std::setw(12) << result.meanNs << std::setw(11) << result.stddevNs << std::setw(8) << cv
+              << std::setw(12) << result.minNs << std::endl;
+}
+
+void writeJson(const std::string& path, const MicroConfig& config, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("Cannot write " + path);
+    }
+    out << std::setprecision(6)
+        << "{\n"
+        << "  \"map\": \"" << config.map.name << "\",\n"
+        << "  \"rangeKernel\": \"" << getRangeKernelName(getRangeKernelIsa()) << "\",\n"
+        << "  \"warmup\": " << config.warmup << ",\n"
+        << "  \"reps\": " << config.reps << ",\n"
+        << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"benchmark\": \"" << r.name << "\", \"distribution\": \"" << distributionName(r.distribution)
+            << "\", \"critters\": " << r.critters << ", \"radius\": " << r.radius
+            << ", \"opsPerRep\": " << r.opsPerRep << ", \"meanNs\": " << r.meanNs
+            << ", \"stddevNs\": " << r.stddevNs << ", \"minNs\": " << r.minNs << ", \"maxNs\": " << r.maxNs << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+// Random spans checked per kernel before any kernel is timed
+constexpr int KERNEL_CHECK_CASES = 2000;
+// Indices past count that must stay untouched
+constexpr std::size_t KERNEL_CHECK_GUARD = 8;
+
+// Compares the current range kernel's output with a plain scalar loop on
+// random spans, including radii that land exactly on a point. Returns false
+// and describes the first mismatch on err if they differ.
+bool checkRangeKernel(unsigned seed, std::ostream& err) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> counts(0, static_cast<int>(RANGE_KERNEL_CHUNK) + 44);
+    // Half-pixel coordinates, so exact ties with the radius are common
+    std::uniform_int_distribution<int> halves(-400, 400);
+    std::uniform_real_distribution<float> radii(0.0f, 250.0f);
+    std::vector<float> xs, ys;
+    std::vector<std::uint32_t> expected, out;
+
+    for (int c = 0; c < KERNEL_CHECK_CASES; ++c) {
+        const std::size_t count = static_cast<std::size_t>(counts(rng));
+        xs.resize(count);
+        ys.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            xs[i] = halves(rng) * 0.5f;
+            ys[i] = halves(rng) * 0.5f;
+        }
+        const float cx = halves(rng) * 0.5f;
+        const float cy = halves(rng) * 0.5f;
+        float radiusSquared = radii(rng);
+        radiusSquared *= radiusSquared;
+        if (count > 0 && c % 2 == 0) {
+            std::size_t on = static_cast<std::size_t>(rng() % count);
+            radiusSquared = (xs[on] - cx) * (xs[on] - cx) + (ys[on] - cy) * (ys[on] - cy);
+        }
+        const std::uint32_t firstIndex = rng() % 1000;
+
+        expected.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            float dx = xs[i] - cx;
+            float dy = ys[i] - cy;
+            if (dx * dx + dy * dy <= radiusSquared) {
+                expected.push_back(firstIndex + static_cast<std::uint32_t>(i));
+            }
+        }
+
+        out.assign(count + KERNEL_CHECK_GUARD, 0xFFFFFFFFu);
+        std::size_t found = filterInRange(xs.data(), ys.data(), count, cx, cy, radiusSquared, firstIndex, out.data());
+        bool match = found == expected.size() && std::equal(expected.begin(), expected.end(), out.begin());
+        bool guarded = std::all_of(out.begin() + count, out.end(), [](std::uint32_t v) { return v == 0xFFFFFFFFu; });
+        if (!match || !guarded) {
+            err << getRangeKernelName(getRangeKernelIsa()) << " kernel differs from the scalar reference: "
+                << count << " points, center (" << cx << ", " << cy << "), radius^2 " << radiusSquared << ", "
+                << found << " hits instead of " << expected.size()
+                << (guarded ? "" : ", wrote past count") << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        MicroConfig config = parseArgs(argc, argv);
+
+        GameWorld world(config.map.level, config.map.width, config.map.height);
+        world.build();
+        CritterSpawner& spawner = world.getSpawner();
+        CritterStore& critters = spawner.getCritters();
+
+        // Tower spots next to the path, spread evenly along it
+        std::vector<sf::Vector2i> spots = bench::towerSpots(world.getMap().getMap(), true);
+        std::vector<sf::Vector2f> positions;
+        std::size_t spotCount = std::min(spots.size(), SAMPLE_POSITIONS);
+        for (std::size_t i = 0; i < spotCount; ++i) {
+            positions.push_back(bench::tileCenter(spots[i * spots.size() / spotCount]));
+        }
+        if (positions.empty()) {
+            throw std::runtime_error("Map has no free tiles next to the path");
+        }
+
+        const StrategyType strategies[] = {StrategyType::SMART, StrategyType::EXIT_PROXIMITY, StrategyType::STRONGEST,
+                                           StrategyType::WEAKEST, StrategyType::CLOSEST};
+        const char* strategyNames[] = {"smart", "exit", "strongest", "weakest", "closest"};
+        const Tower::Type towerTypes[] = {Tower::Type::BASIC, Tower::Type::AREA, Tower::Type::SPECIAL};
+        const char* towerTypeNames[] = {"basic", "area", "special"};
+        const RangeKernelIsa kernels[] = {RangeKernelIsa::SCALAR, RangeKernelIsa::SSE2, RangeKernelIsa::AVX2};
+        const RangeKernelIsa defaultKernel = getRangeKernelIsa();
+
+        // Every kernel must agree with the scalar reference before it is timed
+        for (RangeKernelIsa kernel : kernels) {
+            if (!setRangeKernelIsa(kernel)) continue;
+            if (!checkRangeKernel(config.seed, std::cerr)) {
+                return 2;
+            }
+        }
+        setRangeKernelIsa(defaultKernel);
+
+        std::vector<Result> results;
+        std::mt19937 rng(config.seed);
+        volatile std::uint64_t sink = 0;  // Keeps the timed work from being optimized away
+        auto wanted = [&](const std::string& name) {
+            return config.filter.empty() || name.find(config.filter) != std::string::npos;
+        };
+
+        std::cout << "map " << config.map.name << ", " << positions.size() << " tower positions, range kernel "
+                  << getRangeKernelName(defaultKernel) << "\n"
+                  << "range kernels match the scalar reference on " << KERNEL_CHECK_CASES << " spans each\n\n";
+        printHeader();
+
+        for (Distribution distribution : config.distributions) {
+            for (int count : config.counts) {
+                populate(world, distribution, count, rng);
+                const BattlefieldSummary& summary = spawner.getSummary();
+
+                // Splash impacts on critters spread through the store
+                std::vector<CritterHandle> impacts;
+                std::size_t impactCount = std::min(critters.size(), SAMPLE_POSITIONS);
+                for (std::size_t i = 0; i < impactCount; ++i) {
+                    impacts.push_back(critters.handleAt(i * critters.size() / impactCount));
+                }
+
+                for (int radius : config.ranges) {
+                    auto run = [&](const std::string& name, std::size_t opsPerPass, auto&& op) {
+                        if (!wanted(name)) return;
+                        results.push_back(measure(name, distribution, count, radius, opsPerPass, config, op));
+                        printRow(results.back());
+                    };
+                    const float range = static_cast<float>(radius);
+
+                    for (std::size_t s = 0; s < 5; ++s) {
+                        const TargetingStrategy& strategy = TargetingStrategyFactory::getStrategy(strategies[s]);
+                        run(std::string("findTarget/") + strategyNames[s], positions.size(), [&] {
+                            for (const sf::Vector2f& position : positions) {
+                                sink = sink + strategy.findTarget(position, range, critters).slot;
+                            }
+                        });
+                    }
+
+                    for (std::size_t t = 0; t < 3; ++t) {
+                        std::vector<std::unique_ptr<Tower>> towers;
+                        std::vector<DynamicTargetingManager> managers;
+                        for (const sf::Vector2f& position : positions) {
+                            towers.push_back(std::make_unique<Tower>(position, 0, range, 50.0f, 1.0f, "", towerTypes[t]));
+                        }
+                        for (auto& tower : towers) {
+                            managers.emplace_back(tower.get());
+                        }
+                        run(std::string("selectStrategy/") + towerTypeNames[t], managers.size(), [&] {
+                            for (DynamicTargetingManager& manager : managers) {
+                                sink = sink + static_cast<std::uint64_t>(manager.selectStrategy(critters, summary));
+                            }
+                        });
+                    }
+
+                    // Zero-damage hits resolve the full splash without changing anyone's health
+                    run("dealDamage/splash", impacts.size(), [&] {
+                        for (CritterHandle handle : impacts) {
+                            int index = critters.resolve(handle);
+                            Projectile projectile(critters.getPosition(index) + sf::Vector2f(1.0f, 0.0f),
+                                                  critters, handle, 0.0f, range);
+                            projectile.update(GameWorld::FIXED_TIMESTEP);
+                            sink = sink + projectile.isActive();
+                        }
+                    });
+
+                    for (RangeKernelIsa kernel : kernels) {
+                        if (!setRangeKernelIsa(kernel)) continue;
+                        run(std::string("queryRadius/") + getRangeKernelName(kernel), positions.size(), [&] {
+                            for (const sf::Vector2f& position : positions) {
+                                std::uint64_t found = 0;
+                                critters.queryRadius(position, range, [&](std::size_t) { ++found; });
+                                sink = sink + found;
+                            }
+                        });
+                    }
+                    setRangeKernelIsa(defaultKernel);
+                }
+            }
+        }
+
+        if (!config.jsonPath.empty()) {
+            writeJson(config.jsonPath, config, results);
+            std::cout << "\nwrote " << results.size() << " results to " << config.jsonPath << std::endl;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "td_microbench: " << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+}
@@ -7,7 +7,7 @@
  * Purpose: Implements tower behavior including targeting, shooting,
  * upgrading, and damage calculations.
  * 
- * Dependencies: SFML 3.0, tower.hpp, cmath, stdexcept, algorithm
+ * Dependencies: SFML 3.0, tower.hpp, ProjectileSystem, FrameProfiler, cmath, stdexcept, algorithm
  */
 /**
  * @file Tower.cpp
@@ -18,11 +18,24 @@
  #include "TargetingStrategy.hpp"
  #include "TargetingStrategyFactory.hpp"
  #include "DynamicTargetingManager.hpp"
+ #include "ProjectileSystem.hpp"
+ #include "FrameProfiler.hpp"
  #include <cmath>
  #include <stdexcept>
  #include <algorithm>
  
  
+void* Tower::operator new(std::size_t size) {
+    void* block = ::operator new(size);
+    MemoryTracker::allocated(MemoryTag::TOWERS, size);
+    return block;
+}
+
+void Tower::operator delete(void* block, std::size_t size) noexcept {
+    MemoryTracker::released(MemoryTag::TOWERS, size);
+    ::operator delete(block);
+}
+
  Tower::Tower(const sf::Vector2f& position, 
      int baseCost, 
      float baseRange, 
@@ -39,21 +52,24 @@
  , lastShotTime(0.0f)  
  , towerType(towerType)
  , texturePath(texPath)
+ , position(position)
  , texture()
- , sprite(texture)  
  , isSelected(false)
- , aoeRadius(towerType == Type::AREA ? UNIT_DISTANCE : 0.0f)
- , targetingManager(new DynamicTargetingManager(this))
+ , targetingManager(this)
  {
-     loadTexture();
-     sprite.setPosition(position);
+     recomputeStats();
  }
  
- void Tower::loadTexture() {
-     if (!texture.loadFromFile(texturePath)) {
-         throw std::runtime_error("Failed to load tower texture: " + texturePath);
+ void Tower::update(float deltaTime) {
+     fireTimer += deltaTime;
+ }
+ 
+ void Tower::draw(sf::RenderWindow& window) const {
+     if (!texture) {
+         texture = TextureCache::instance().acquire(texturePath);
      }
-     sprite.setTexture(texture, true);
+
+     sf::Sprite sprite(*texture);
      
      // Scale sprite to fit one tile (64x64)
      const float TILE_SIZE = 64.0f;
@@ -64,25 +80,17 @@
      // Center the sprite origin
      sf::FloatRect bounds = sprite.getLocalBounds();
      sprite.setOrigin(sf::Vector2f(bounds.size.x / 2.f, bounds.size.y / 2.f));
- }
- 
- void Tower::update(float deltaTime) {
-     fireTimer += deltaTime;
-     updateProjectiles(deltaTime);
- }
- 
- void Tower::draw(sf::RenderWindow& window) const {
+     sprite.setPosition(position);
      window.draw(sprite);
-     drawProjectiles(window);
      
      // Draw range indicator 
      if (isSelected) {
-         sf::CircleShape rangeIndicator(range);
+         sf::CircleShape rangeIndicator(stats.range);
          // Convert the position to Vector2f and offset by range to center the circle
          rangeIndicator.setPosition(
              sf::Vector2f(
-                 sprite.getPosition().x - range,
-                 sprite.getPosition().y - range
+                 position.x - stats.range,
+                 position.y - stats.range
              )
          );
          rangeIndicator.setFillColor(sf::Color(255, 255, 255, 32));
@@ -90,11 +98,12 @@
          rangeIndicator.setOutlineThickness(1.0f);
          window.draw(rangeIndicator);
      }
+     FrameProfiler::instance().countDrawCalls(isSelected ? 2 : 1);
  }
  
 
 StrategyType Tower::getCurrentStrategyType() const {
-    return targetingManager->getCurrentStrategyType();
+    return targetingManager.getCurrentStrategyType();
 }
 
 
@@ -105,30 +114,54 @@ StrategyType Tower::getCurrentStrategyType() const {
  
      std::string nextLevelTexturePath = getUpgradedTexturePath();
      
-     // Store the old position before upgrading
-     sf::Vector2f oldPosition = sprite.getPosition();
-     
      currentLevel++;
      
-     // Improve tower stats with each upgrade
-     range *= 1.2f;    // 20% range increase
-     power *= 1.5f;    // 50% power increase
-     fireRate *= 1.2f; // 20% fire rate increase
-     
-     // Update AoE radius for area towers
-     if (towerType == Type::AREA) {
-         aoeRadius = UNIT_DISTANCE * currentLevel;  // Increase AoE radius with level
-     }
+     // Improve tower stats with each upgrade (the AoE radius grows with level in recomputeStats)
+     addModifiers({
+         {TowerModifier::Stat::RANGE, 1.2f},      // 20% range increase
+         {TowerModifier::Stat::POWER, 1.5f},      // 50% power increase
+         {TowerModifier::Stat::FIRE_RATE, 1.2f}   // 20% fire rate increase
+     });
      
+     // Swap to the next stage's texture on the next draw
      texturePath = nextLevelTexturePath;
-     loadTexture();
-     
-     // Restore the position after texture reload
-     sprite.setPosition(oldPosition);
+     texture.reset();
      
      return true;
  }
  
+ void Tower::addModifier(const TowerModifier& modifier) {
+     modifiers.push_back(modifier);
+     recomputeStats();
+ }
+
+ void Tower::addModifiers(std::initializer_list<TowerModifier> list) {
+     modifiers.insert(modifiers.end(), list.begin(), list.end());
+     recomputeStats();
+ }
+
+ void Tower::recomputeStats() {
+     EffectiveStats folded;
+     folded.range = range;
+     folded.power = power;
+     folded.fireRate = fireRate;
+     // Area towers splash one tile per level
+     folded.aoeRadius = (towerType == Type::AREA) ? UNIT_DISTANCE * currentLevel : 0.0f;
+
+     for (const TowerModifier& modifier : modifiers) {
+         switch (modifier.stat) {
+             case TowerModifier::Stat::RANGE:        folded.range *= modifier.factor; break;
+             case TowerModifier::Stat::POWER:        folded.power *= modifier.factor; break;
+             case TowerModifier::Stat::FIRE_RATE:    folded.fireRate *= modifier.factor; break;
+             case TowerModifier::Stat::AOE_RADIUS:   folded.aoeRadius *= modifier.factor; break;
+             case TowerModifier::Stat::UPGRADE_COST: folded.upgradeCostFactor *= modifier.factor; break;
+             case TowerModifier::Stat::REFUND_VALUE: folded.refundFactor *= modifier.factor; break;
+             case TowerModifier::Stat::LEVEL3_FOCUS: folded.level3Focus = true; break;
+         }
+     }
+     stats = folded;
+ }
+
  std::string Tower::getUpgradedTexturePath() const {
      std::string basePath;
      switch(towerType) {
@@ -147,56 +180,62 @@ StrategyType Tower::getCurrentStrategyType() const {
      return basePath + std::to_string(currentLevel + 1) + ".png";
  }
  
- void Tower::updateProjectiles(float deltaTime) {
-     // Update existing projectiles
-     for (auto& projectile : projectiles) {
-         projectile->update(deltaTime);
-     }
- 
-     // Remove inactive projectiles
-     projectiles.erase(
-         std::remove_if(projectiles.begin(), projectiles.end(), 
-                        [](const std::unique_ptr<Projectile>& p) { return !p->isActive(); }),
-         projectiles.end()
-     );
- }
- 
- void Tower::drawProjectiles(sf::RenderWindow& window) const {
-     for (const auto& projectile : projectiles) {
-         projectile->draw(window);
-     }
- }
- 
- void Tower::findAndShootTarget(std::vector<std::unique_ptr<Critter>>& critters) {
-     if (fireTimer - lastShotTime < (1.0f / fireRate)) {
+ void Tower::findAndShootTarget(CritterStore& critters, const BattlefieldSummary& summary, ProjectileSystem& projectiles) {
+     if (fireTimer - lastShotTime < (1.0f / stats.fireRate)) {
          return;
      }
  
-     Critter* target = findBestTarget(critters);
-     if (target) {
+     CritterHandle target = findBestTarget(critters, summary);
+     if (!target.isNull()) {
          // Create a projectile with AoE properties if it's an area tower
-         float projectileAoeRadius = (towerType == Type::AREA) ? aoeRadius : 0.0f;
+         float projectileAoeRadius = (towerType == Type::AREA) ? stats.aoeRadius : 0.0f;
          bool isSpecial = (towerType == Type::SPECIAL);  // Check if this is a special tower
          
-         projectiles.push_back(std::make_unique<Projectile>(
-             sprite.getPosition(),
+         bool fired = projectiles.spawn(
+             position,
+             critters,   // Store used to follow the target and apply AoE damage
              target,
-             power,
+             stats.power,
              projectileAoeRadius,
-             &critters,  // Pass reference to all critters for AoE damage
              isSpecial   // Pass the special tower flag
-         ));
+         );
          
-         lastShotTime = fireTimer;
+         // A refused shot leaves the tower ready to fire on the next tick
+         if (fired) {
+             lastShotTime = fireTimer;
+         }
      }
  }
  
- Critter* Tower::findBestTarget(std::vector<std::unique_ptr<Critter>>& critters) {
+ CritterHandle Tower::findBestTarget(const CritterStore& critters, const BattlefieldSummary& summary) {
+    // Focused towers take the level 3 critter in range closest to the exit, if any
+    if (stats.level3Focus) {
+        const CritterTypeRegistry& types = CritterTypeRegistry::instance();
+        int focusTarget = -1;
+        float bestDistance = -1.0f;
+        std::uint64_t scanned = 0;
+        critters.queryRadius(position, stats.range, [&](std::size_t i) {
+            if (critters.isDead(i)) return;
+            ++scanned;
+            if (types.get(critters.getTypeId(i)).level == 3 &&
+                critters.getDistanceTravelled(i) > bestDistance) {
+                bestDistance = critters.getDistanceTravelled(i);
+                focusTarget = static_cast<int>(i);
+            }
+        });
+        CounterRegistry::add(Counter::FIND_TARGET_CALLS);
+        CounterRegistry::add(Counter::CRITTERS_SCANNED, scanned);
+        if (focusTarget >= 0) {
+            return critters.handleAt(focusTarget);
+        }
+    }
+
     // Use the targeting manager to select appropriate strategy
-    std::shared_ptr<TargetingStrategy> strategy = targetingManager->selectStrategy(critters);
+    StrategyType strategy = targetingManager.selectStrategy(critters, summary);
+    CounterRegistry::add(strategyCounter(strategy));
     
-    // Use the selected strategy to find a target
-    return strategy->findTarget(sprite.getPosition(), range, critters);
+    // Run the selected strategy's scan to find a target
+    return findTargetWith(strategy, position, stats.range, critters);
 }
  
  int Tower::getRefundValue() const {
@@ -204,12 +243,12 @@ StrategyType Tower::getCurrentStrategyType() const {
      int totalInvestment = cost;
      if (currentLevel >= 2) totalInvestment += LEVEL_2_COST;
      if (currentLevel >= 3) totalInvestment += LEVEL_3_COST;
-     return static_cast<int>(totalInvestment * 0.75f);
+     return static_cast<int>(totalInvestment * 0.75f * stats.refundFactor);
  }
  
  int Tower::getUpgradeCost() const {
-     if (currentLevel == 1) return LEVEL_2_COST;
-     if (currentLevel == 2) return LEVEL_3_COST;
+     if (currentLevel == 1) return static_cast<int>(LEVEL_2_COST * stats.upgradeCostFactor);
+     if (currentLevel == 2) return static_cast<int>(LEVEL_3_COST * stats.upgradeCostFactor);
      return 0;  // Can't upgrade level 3
  }
  
@@ -5,9 +5,10 @@
  * Tower.hpp - Defense tower class definition
  * 
  * Purpose: Defines tower types and their behaviors including targeting,
- * shooting mechanics, and upgrade system.
+ * shooting mechanics, and upgrade system. Upgrades are kept as a list of
+ * TowerModifiers folded into cached EffectiveStats.
  * 
- * Dependencies: SFML 3.0, Projectile, Critter
+ * Dependencies: SFML 3.0, ProjectileSystem, CritterStore, TowerModifier, MemoryTracker
  */
 /**
  * @file tower.hpp
@@ -19,12 +20,16 @@
  #include <vector>
  #include <string>
  #include <memory>
- #include "Critter.hpp"
- #include "Projectile.hpp"
+ #include <initializer_list>
+ #include "CritterStore.hpp"
  #include "TargetingStrategy.hpp"
  #include "TargetingStrategyFactory.hpp"
  #include "DynamicTargetingManager.hpp"
+ #include "TextureCache.hpp"
+ #include "MemoryTracker.hpp"
+ #include "TowerModifier.hpp"
 class DynamicTargetingManager;
+class ProjectileSystem;
 
 class Tower {
 public:
@@ -43,36 +48,48 @@ public:
           Type towerType);
     
     virtual ~Tower() = default;
+    // Towers are counted under MemoryTag::TOWERS at their full dynamic size
+    static void* operator new(std::size_t size);
+    static void operator delete(void* block, std::size_t size) noexcept;
+    // The targeting manager points back at this tower, so towers stay put
+    Tower(const Tower&) = delete;
+    Tower& operator=(const Tower&) = delete;
 
     // Core tower methods
-    virtual void update(float deltaTime);
-    virtual void draw(sf::RenderWindow& window) const;
-    virtual bool upgrade(); // Returns false if max level reached
+    void update(float deltaTime);
+    void draw(sf::RenderWindow& window) const;
+    bool upgrade(); // Returns false if max level reached
 
-    // Projectile-related methods
-    virtual void updateProjectiles(float deltaTime);
-    virtual void drawProjectiles(sf::RenderWindow& window) const;
-    virtual void findAndShootTarget(std::vector<std::unique_ptr<Critter>>& critters);
+    // Picks a target and, if the tower is ready, fires at it through projectiles.
+    // summary is this tick's wave-wide critter overview from the spawner.
+    void findAndShootTarget(CritterStore& critters, const BattlefieldSummary& summary, ProjectileSystem& projectiles);
+
+    // Appends upgrade effects and refreshes the effective stats
+    void addModifier(const TowerModifier& modifier);
+    void addModifiers(std::initializer_list<TowerModifier> list);
 
     // Selection
-    virtual void setSelected(bool selected);
+    void setSelected(bool selected);
 
     // Getters
-    virtual int getLevel() const { return currentLevel; }
-    virtual int getCost() const { return cost; }
-    virtual int getRefundValue() const;
-    virtual float getRange() const { return range; }
-    virtual sf::Vector2f getPosition() const { return sprite.getPosition(); }
-    virtual bool canUpgrade() const { return currentLevel < MAX_LEVEL; }
-    virtual int getUpgradeCost() const;
-    virtual float getFireRate() const { return fireRate; }
-    virtual float getPower() const { return power; }
-    virtual const sf::Sprite& getSprite() const { return sprite; }
-    virtual std::string getTexturePath() const { return texturePath; }
-    virtual Type getTowerType() const { return towerType; }  
-    virtual StrategyType getCurrentStrategyType() const;
-    virtual float getAoeRadius() const { return aoeRadius; }
-    virtual float getSpecialMultiplier() const { return 12.0f; } // The multiplier used in Projectile.cpp
+    int getLevel() const { return currentLevel; }
+    int getCost() const { return cost; }
+    int getRefundValue() const;
+    float getRange() const { return stats.range; }
+    sf::Vector2f getPosition() const { return position; }
+    bool canUpgrade() const { return currentLevel < MAX_LEVEL; }
+    int getUpgradeCost() const;
+    float getFireRate() const { return stats.fireRate; }
+    float getPower() const { return stats.power; }
+    const std::string& getTexturePath() const { return texturePath; }
+    Type getTowerType() const { return towerType; }  
+    StrategyType getCurrentStrategyType() const;
+    float getAoeRadius() const { return stats.aoeRadius; }
+    float getSpecialMultiplier() const { // The multiplier used in Projectile.cpp
+        return CritterTypeRegistry::instance().get(CritterTypeRegistry::STRONG).specialMultiplier;
+    }
+    const EffectiveStats& getStats() const { return stats; }
+    const TrackedVector<TowerModifier, MemoryTag::TOWERS>& getModifiers() const { return modifiers; }
 protected:
     // Tower properties
     static const int MAX_LEVEL = 3;
@@ -80,7 +97,7 @@ protected:
     static const int LEVEL_3_COST = 200;
 
 private:
-    // Core stats
+    // Core stats, before any upgrade
     int currentLevel;
     int cost;
     float range;
@@ -92,35 +109,28 @@ private:
     // Tower identity
     Type towerType;
     std::string texturePath;
+    sf::Vector2f position;
 
-    // Graphics
-    sf::Texture texture;
-    sf::Sprite sprite;  
+    // Graphics (fetched from the shared cache on first draw so headless worlds never touch the GPU)
+    mutable TextureCache::Handle texture;
     
     
     // Area effect properties
     bool isSelected = false;
-    float aoeRadius = 0.0f;  // Base radius for area effect
     static constexpr float UNIT_DISTANCE = 64.0f;  // One unit = one tile size
-    
-
-    
-
-    
-
-    
-    // Projectiles
-    std::vector<std::unique_ptr<Projectile>> projectiles;
 
+    // Upgrade effects in the order they were bought, and their folded result
+    TrackedVector<TowerModifier, MemoryTag::TOWERS> modifiers;
+    EffectiveStats stats;
 
     // Targeting Manager
-    std::unique_ptr<DynamicTargetingManager> targetingManager;
+    DynamicTargetingManager targetingManager;
    
 
     // Helper methods
-    void loadTexture();
-    Critter* findBestTarget(std::vector<std::unique_ptr<Critter>>& critters);
+    CritterHandle findBestTarget(const CritterStore& critters, const BattlefieldSummary& summary);
     std::string getUpgradedTexturePath() const;
+    void recomputeStats();
 
 
 };
\ No newline at end of file